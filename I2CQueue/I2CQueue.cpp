@@ -0,0 +1,90 @@
+/* I2CQueue - queued, non-blocking I2C register transfers
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "I2CQueue.h"
+
+// status of a synchronous transfer while it is still queued
+#define SYNC_PENDING 1
+
+I2CQueue::I2CQueue() : m_head(0), m_count(0) { }
+
+I2CQueue::~I2CQueue() { }
+
+int I2CQueue::queueRead(int addr, uint8_t reg, uint8_t *data, int len, I2CQueueCallback done, void *context) {
+    return submit(addr, reg, data, len, true, done, context);
+}
+
+int I2CQueue::queueWrite(int addr, uint8_t reg, const uint8_t *data, int len, I2CQueueCallback done, void *context) {
+    return submit(addr, reg, (uint8_t *)data, len, false, done, context);
+}
+
+int I2CQueue::read(int addr, uint8_t reg, uint8_t *data, int len) {
+    return transfer(addr, reg, data, len, true);
+}
+
+int I2CQueue::write(int addr, uint8_t reg, const uint8_t *data, int len) {
+    return transfer(addr, reg, (uint8_t *)data, len, false);
+}
+
+int I2CQueue::pending() {
+    return m_count;
+}
+
+int I2CQueue::submit(int addr, uint8_t reg, uint8_t *data, int len, bool isRead, I2CQueueCallback done, void *context) {
+    lock();
+    if (m_count == I2C_QUEUE_DEPTH) {
+        unlock();
+        return I2C_QUEUE_FULL;
+    }
+    Transfer *t = &m_queue[(m_head + m_count) % I2C_QUEUE_DEPTH];
+    t->addr = addr;
+    t->reg = reg;
+    t->data = data;
+    t->len = len;
+    t->isRead = isRead;
+    t->done = done;
+    t->context = context;
+    int idle = (m_count == 0);
+    m_count++;
+    unlock();
+
+    // nothing can complete while the bus is idle, so this is safe unlocked
+    if (idle)
+        start(t);
+    return I2C_QUEUE_OK;
+}
+
+int I2CQueue::transfer(int addr, uint8_t reg, uint8_t *data, int len, bool isRead) {
+    volatile int status = SYNC_PENDING;
+    while (submit(addr, reg, data, len, isRead, &I2CQueue::syncDone, (void *)&status) == I2C_QUEUE_FULL)
+        ;
+    while (status == SYNC_PENDING)
+        ;
+    return status;
+}
+
+void I2CQueue::syncDone(void *context, int status) {
+    *(volatile int *)context = status;
+}
+
+void I2CQueue::complete(int status) {
+    Transfer done = m_queue[m_head];
+
+    lock();
+    m_head = (m_head + 1) % I2C_QUEUE_DEPTH;
+    m_count--;
+    int more = (m_count > 0);
+    unlock();
+
+    if (more)
+        start(&m_queue[m_head]);
+    if (done.done != NULL)
+        done.done(done.context, status);
+}
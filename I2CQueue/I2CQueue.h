@@ -0,0 +1,120 @@
+/* I2CQueue - queued, non-blocking I2C register transfers
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef I2CQUEUE_H
+#define I2CQUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define I2C_QUEUE_DEPTH 8
+
+#define I2C_QUEUE_OK                0
+#define I2C_QUEUE_NACK             -1
+#define I2C_QUEUE_ARBITRATION_LOST -2
+#define I2C_QUEUE_FULL             -3
+
+/** Completion callback, called from interrupt context
+ *
+ * @param context pointer given when the transfer was queued
+ * @param status I2C_QUEUE_OK or a negative error
+ */
+typedef void (*I2CQueueCallback)(void *context, int status);
+
+/** Queue of register transfers shared by every device on one bus
+ *
+ * Transfers run back to back in the order they were queued. The queue
+ * itself is hardware independent; a back end (I2CQueueK64F on target)
+ * drives the bus.
+ *
+ * Example:
+ * @code
+ * I2CQueueK64F i2c(PTE25, PTE24);        // 400 kHz fast mode
+ * uint8_t xyz[6];
+ * volatile int ready = 0;
+ *
+ * void onSample(void *context, int status) { ready = 1; }
+ *
+ * i2c.queueRead(0x1d<<1, 0x01, xyz, 6, &onSample, NULL);
+ * // ... draw while the sample is fetched ...
+ * @endcode
+ */
+class I2CQueue
+{
+public:
+    I2CQueue();
+    virtual ~I2CQueue();
+
+    /** Queue a read of consecutive registers
+     *
+     * @param addr 8-bit device address (mbed convention)
+     * @param reg first register
+     * @param data buffer, must stay valid until done is called
+     * @param len number of bytes
+     * @param done completion callback, may be NULL
+     * @param context passed to done
+     * @returns I2C_QUEUE_OK, or I2C_QUEUE_FULL if nothing was queued
+     */
+    int queueRead(int addr, uint8_t reg, uint8_t *data, int len, I2CQueueCallback done, void *context);
+
+    /** Queue a write of consecutive registers
+     *
+     * @param data bytes to write, must stay valid until done is called
+     * @returns I2C_QUEUE_OK, or I2C_QUEUE_FULL if nothing was queued
+     */
+    int queueWrite(int addr, uint8_t reg, const uint8_t *data, int len, I2CQueueCallback done, void *context);
+
+    /** Read registers and wait, behind anything already queued
+     *
+     * @returns I2C_QUEUE_OK or a negative error
+     */
+    int read(int addr, uint8_t reg, uint8_t *data, int len);
+
+    /** Write registers and wait, behind anything already queued
+     *
+     * @returns I2C_QUEUE_OK or a negative error
+     */
+    int write(int addr, uint8_t reg, const uint8_t *data, int len);
+
+    /** Number of transfers queued or in flight */
+    int pending();
+
+protected:
+    struct Transfer {
+        int addr;
+        uint8_t reg;
+        uint8_t *data;
+        int len;
+        bool isRead;
+        I2CQueueCallback done;
+        void *context;
+    };
+
+    /** Put the transfer on the bus; the back end calls complete() when it is over */
+    virtual void start(Transfer *t) = 0;
+
+    /** Keep the completion interrupt out of queue updates */
+    virtual void lock() { }
+    virtual void unlock() { }
+
+    /** Retire the transfer at the head of the queue and start the next one */
+    void complete(int status);
+
+private:
+    int submit(int addr, uint8_t reg, uint8_t *data, int len, bool isRead, I2CQueueCallback done, void *context);
+    int transfer(int addr, uint8_t reg, uint8_t *data, int len, bool isRead);
+    static void syncDone(void *context, int status);
+
+    Transfer m_queue[I2C_QUEUE_DEPTH];
+    volatile int m_head;
+    volatile int m_count;
+};
+
+#endif
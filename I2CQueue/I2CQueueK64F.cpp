@@ -0,0 +1,165 @@
+/* I2CQueueK64F - interrupt driven I2CQueue back end for the Kinetis K64F
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "I2CQueueK64F.h"
+#include "pinmap.h"
+#include "PeripheralPins.h"
+
+I2CQueueK64F *I2CQueueK64F::s_instance[3] = {NULL, NULL, NULL};
+
+static I2C_Type * const i2c_base[3] = {I2C0, I2C1, I2C2};
+static const IRQn_Type i2c_irqn[3] = {I2C0_IRQn, I2C1_IRQn, I2C2_IRQn};
+
+I2CQueueK64F::I2CQueueK64F(PinName sda, PinName scl, int hz) :
+        m_i2c(sda, scl), m_state(STATE_IDLE), m_cur(NULL), m_index(0) {
+    uint32_t instance = pinmap_peripheral(sda, PinMap_I2C_SDA);
+    m_base = i2c_base[instance];
+    m_irqn = i2c_irqn[instance];
+    s_instance[instance] = this;
+
+    m_i2c.frequency(hz);
+
+    static const uint32_t vectors[3] = {
+        (uint32_t)&I2CQueueK64F::irq0,
+        (uint32_t)&I2CQueueK64F::irq1,
+        (uint32_t)&I2CQueueK64F::irq2
+    };
+    NVIC_SetVector(m_irqn, vectors[instance]);
+    NVIC_EnableIRQ(m_irqn);
+}
+
+I2CQueueK64F::~I2CQueueK64F() {
+    NVIC_DisableIRQ(m_irqn);
+    m_base->C1 &= ~I2C_C1_IICIE_MASK;
+    for (int i = 0; i < 3; i++) {
+        if (s_instance[i] == this)
+            s_instance[i] = NULL;
+    }
+}
+
+void I2CQueueK64F::lock() {
+    NVIC_DisableIRQ(m_irqn);
+}
+
+void I2CQueueK64F::unlock() {
+    NVIC_EnableIRQ(m_irqn);
+}
+
+void I2CQueueK64F::start(Transfer *t) {
+    m_cur = t;
+    m_state = STATE_ADDR_W;
+
+    // the STOP of the previous transfer takes a few bus clocks to release the bus
+    while (m_base->S & I2C_S_BUSY_MASK)
+        ;
+    m_base->S = I2C_S_IICIF_MASK | I2C_S_ARBL_MASK;
+    m_base->C1 = I2C_C1_IICEN_MASK | I2C_C1_IICIE_MASK | I2C_C1_MST_MASK | I2C_C1_TX_MASK;
+    m_base->D = t->addr & 0xFE;
+}
+
+void I2CQueueK64F::stop() {
+    m_base->C1 &= ~(I2C_C1_MST_MASK | I2C_C1_TX_MASK | I2C_C1_TXAK_MASK);
+}
+
+void I2CQueueK64F::finish(int status) {
+    m_state = STATE_IDLE;
+    // leave the interrupt off between transfers so that a blocking
+    // mbed I2C object can still use the bus once the queue drains
+    m_base->C1 &= ~I2C_C1_IICIE_MASK;
+    complete(status);
+}
+
+void I2CQueueK64F::irq() {
+    uint8_t status = m_base->S;
+    m_base->S = I2C_S_IICIF_MASK | I2C_S_ARBL_MASK;
+
+    if (m_state == STATE_IDLE)
+        return;
+
+    if (status & I2C_S_ARBL_MASK) {
+        stop();
+        finish(I2C_QUEUE_ARBITRATION_LOST);
+        return;
+    }
+    // every state but the data read phase has just sent a byte
+    if (m_state != STATE_DATA_R && (status & I2C_S_RXAK_MASK)) {
+        stop();
+        finish(I2C_QUEUE_NACK);
+        return;
+    }
+
+    switch (m_state) {
+        case STATE_ADDR_W:
+            m_state = STATE_REG;
+            m_base->D = m_cur->reg;
+            break;
+        case STATE_REG:
+            if (m_cur->isRead) {
+                m_state = STATE_ADDR_R;
+                m_base->C1 |= I2C_C1_RSTA_MASK;
+                m_base->D = m_cur->addr | 0x01;
+            } else if (m_cur->len > 0) {
+                m_state = STATE_DATA_W;
+                m_index = 0;
+                m_base->D = m_cur->data[m_index++];
+            } else {
+                stop();
+                finish(I2C_QUEUE_OK);
+            }
+            break;
+        case STATE_DATA_W:
+            if (m_index < m_cur->len) {
+                m_base->D = m_cur->data[m_index++];
+            } else {
+                stop();
+                finish(I2C_QUEUE_OK);
+            }
+            break;
+        case STATE_ADDR_R:
+            m_state = STATE_DATA_R;
+            m_index = 0;
+            m_base->C1 &= ~I2C_C1_TX_MASK;
+            if (m_cur->len == 1) {
+                m_base->C1 |= I2C_C1_TXAK_MASK;    // NACK the only byte
+            } else {
+                m_base->C1 &= ~I2C_C1_TXAK_MASK;
+            }
+            (void)m_base->D;                       // dummy read clocks in the first byte
+            break;
+        case STATE_DATA_R:
+            if (m_cur->len - m_index == 1) {
+                stop();                            // STOP before reading D ends the transfer
+                m_cur->data[m_index++] = m_base->D;
+                finish(I2C_QUEUE_OK);
+            } else {
+                if (m_cur->len - m_index == 2)
+                    m_base->C1 |= I2C_C1_TXAK_MASK;  // NACK the last byte
+                m_cur->data[m_index++] = m_base->D;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void I2CQueueK64F::irq0() {
+    if (s_instance[0] != NULL)
+        s_instance[0]->irq();
+}
+
+void I2CQueueK64F::irq1() {
+    if (s_instance[1] != NULL)
+        s_instance[1]->irq();
+}
+
+void I2CQueueK64F::irq2() {
+    if (s_instance[2] != NULL)
+        s_instance[2]->irq();
+}
@@ -0,0 +1,70 @@
+/* I2CQueueK64F - interrupt driven I2CQueue back end for the Kinetis K64F
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+ /*
+  * Note: the mbed I2C object is only used to mux the pins and set the
+  * clock. Every byte after that is moved by the I2C interrupt, so the
+  * CPU is free (e.g. for SPI display transfers) while a transfer runs.
+  * Do not use a blocking mbed I2C object on the same bus while
+  * transfers are pending.
+  */
+#ifndef I2CQUEUE_K64F_H
+#define I2CQUEUE_K64F_H
+
+#include "mbed.h"
+#include "I2CQueue.h"
+
+#define I2C_FAST_MODE 400000
+
+class I2CQueueK64F : public I2CQueue
+{
+public:
+    /** Create a queue on the I2C peripheral behind the given pins
+     *
+     * @param sda SDA pin
+     * @param scl SCL pin
+     * @param hz bus clock, fast mode by default
+     */
+    I2CQueueK64F(PinName sda, PinName scl, int hz = I2C_FAST_MODE);
+
+    virtual ~I2CQueueK64F();
+
+protected:
+    virtual void start(Transfer *t);
+    virtual void lock();
+    virtual void unlock();
+
+private:
+    enum State {
+        STATE_IDLE,
+        STATE_ADDR_W,
+        STATE_REG,
+        STATE_DATA_W,
+        STATE_ADDR_R,
+        STATE_DATA_R
+    };
+
+    void irq();
+    void stop();
+    void finish(int status);
+    static void irq0();
+    static void irq1();
+    static void irq2();
+    static I2CQueueK64F *s_instance[3];
+
+    I2C m_i2c;
+    I2C_Type *m_base;
+    IRQn_Type m_irqn;
+    volatile State m_state;
+    Transfer *m_cur;
+    int m_index;
+};
+
+#endif
@@ -0,0 +1,501 @@
+#include "Compositor.h"
+
+static int runCount(const uint8_t *runs, int i)
+{
+	const uint8_t *p = runs + i * LEVEL_RUN_SIZE;
+	return p[0] | (p[1] << 8);
+}
+
+static uint16_t runColor(const uint8_t *runs, int i)
+{
+	const uint8_t *p = runs + i * LEVEL_RUN_SIZE;
+	return p[2] | (p[3] << 8);
+}
+
+/* Half-widths for radius r, worked out the first time it is used */
+static const uint8_t *discRows(Compositor *c, int r)
+{
+	if (!(c->haveRows & (1UL << r))) {
+		crescentDiscRows(r, c->discRows[r]);
+		c->haveRows |= 1UL << r;
+	}
+	return c->discRows[r];
+}
+
+/* Columns a shape covers on row y, or 0 if it misses the row */
+static int shapeRow(const Compositor *c, const CompShape *s, int y, int *x0, int *x1)
+{
+	if (s->r == 0) {
+		if (y < s->y0 || y > s->y1) {
+			return 0;
+		}
+		*x0 = s->x0;
+		*x1 = s->x1;
+		return 1;
+	}
+	int dy = y - s->y0;
+	if (dy < 0) dy = -dy;
+	if (dy > s->r) {
+		return 0;
+	}
+	*x0 = s->x0 - c->discRows[s->r][dy];
+	*x1 = s->x0 + c->discRows[s->r][dy];
+	return 1;
+}
+
+static int spriteRow(const Compositor *c, const CompSprite *s, int y, int *x0, int *x1)
+{
+	int dy = y - s->y;
+	if (dy < 0) dy = -dy;
+	if (!s->visible || dy > s->r) {
+		return 0;
+	}
+	*x0 = s->x - c->discRows[s->r][dy];
+	*x1 = s->x + c->discRows[s->r][dy];
+	return 1;
+}
+
+static void fillLine(uint16_t *line, int x0, int x1, int lo, int hi, uint16_t color)
+{
+	if (x0 < lo) x0 = lo;
+	if (x1 > hi) x1 = hi;
+	for (int x = x0; x <= x1; x++) {
+		line[x] = color;
+	}
+}
+
+/* Static layer of row y, columns x0..x1, into out[x0..x1] */
+static void staticRow(const Compositor *c, int y, int x0, int x1, uint16_t *out)
+{
+	if (c->runs == 0) {
+		fillLine(out, x0, x1, x0, x1, c->background);
+		for (int i = 0; i < c->numShapes; i++) {
+			int a, b;
+			if (shapeRow(c, &c->shapes[i], y, &a, &b)) {
+				fillLine(out, a, b, x0, x1, c->shapes[i].color);
+			}
+		}
+		return;
+	}
+
+	int i = c->rowRun[y];
+	int skip = c->rowSkip[y] + x0;
+	while (i < c->numRuns && skip >= runCount(c->runs, i)) {
+		skip -= runCount(c->runs, i++);
+	}
+	for (int x = x0; x <= x1; ) {
+		if (i >= c->numRuns) {
+			fillLine(out, x, x1, x, x1, c->background);
+			break;
+		}
+		int n = runCount(c->runs, i) - skip;
+		int end = x + n - 1;
+		fillLine(out, x, end, x, x1, runColor(c->runs, i));
+		x = end + 1;
+		skip = 0;
+		i++;
+	}
+}
+
+uint16_t compStaticPixel(const Compositor *c, int x, int y)
+{
+	if (c->runs == 0) {
+		for (int i = c->numShapes - 1; i >= 0; i--) {
+			int a, b;
+			if (shapeRow(c, &c->shapes[i], y, &a, &b) && x >= a && x <= b) {
+				return c->shapes[i].color;
+			}
+		}
+		return c->background;
+	}
+	int i = c->rowRun[y];
+	int skip = c->rowSkip[y] + x;
+	while (i < c->numRuns && skip >= runCount(c->runs, i)) {
+		skip -= runCount(c->runs, i++);
+	}
+	return i < c->numRuns ? runColor(c->runs, i) : c->background;
+}
+
+/* Does overlay o cover pixel x of its row y? */
+static int overlayAt(const CompRect *o, int x, int y)
+{
+	if (!o->visible || x < o->x0 || x > o->x1 || y < o->y0 || y > o->y1) {
+		return 0;
+	}
+	return o->mask == 0 || ((o->mask[y - o->y0] >> (x - o->x0)) & 1);
+}
+
+/* Everything at one pixel, top layer first */
+static uint16_t scenePixel(const Compositor *c, int x, int y)
+{
+	int i, a, b;
+	for (i = COMP_MAX_OVERLAYS - 1; i >= 0; i--) {
+		if (overlayAt(&c->overlays[i], x, y)) {
+			return c->overlays[i].color;
+		}
+	}
+	for (i = COMP_MAX_SPRITES - 1; i >= 0; i--) {
+		if (spriteRow(c, &c->sprites[i], y, &a, &b) && x >= a && x <= b) {
+			return c->sprites[i].color;
+		}
+	}
+	return compStaticPixel(c, x, y);
+}
+
+static void send(Compositor *c, int x0, int y0, int x1, int y1, uint16_t color)
+{
+	c->fill(c->ctx, x0, y0, x1, y1, color);
+	c->spans++;
+	c->pixels += (x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+/* Resolve row y, columns x0..x1, and send it as spans of one colour */
+static void resolveRow(Compositor *c, int y, int x0, int x1)
+{
+	uint16_t *line = c->line;
+	int i, a, b;
+
+	if (y < 0 || y >= c->height) {
+		return;
+	}
+	if (x0 < 0) x0 = 0;
+	if (x1 >= c->width) x1 = c->width - 1;
+	if (x0 > x1) {
+		return;
+	}
+	staticRow(c, y, x0, x1, line);
+	for (i = 0; i < COMP_MAX_SPRITES; i++) {
+		if (spriteRow(c, &c->sprites[i], y, &a, &b)) {
+			fillLine(line, a, b, x0, x1, c->sprites[i].color);
+		}
+	}
+	for (i = 0; i < COMP_MAX_OVERLAYS; i++) {
+		const CompRect *o = &c->overlays[i];
+		if (!o->visible || y < o->y0 || y > o->y1) {
+			continue;
+		}
+		if (o->mask == 0) {
+			fillLine(line, o->x0, o->x1, x0, x1, o->color);
+			continue;
+		}
+		uint16_t bits = o->mask[y - o->y0];
+		for (a = o->x0; bits; a++, bits >>= 1) {
+			if ((bits & 1) && a >= x0 && a <= x1) {
+				line[a] = o->color;
+			}
+		}
+	}
+	for (a = x0; a <= x1; a = b + 1) {
+		for (b = a; b < x1 && line[b + 1] == line[a]; b++) {
+		}
+		send(c, a, y, b, y, line[a]);
+	}
+}
+
+/* The same down column x, pixel by pixel */
+static void resolveColumn(Compositor *c, int x, int y0, int y1)
+{
+	if (x < 0 || x >= c->width) {
+		return;
+	}
+	if (y0 < 0) y0 = 0;
+	if (y1 >= c->height) y1 = c->height - 1;
+	int start = y0;
+	uint16_t color = 0;
+	for (int y = y0; y <= y1; y++) {
+		uint16_t here = scenePixel(c, x, y);
+		if (y > start && here != color) {
+			send(c, x, start, x, y - 1, color);
+			start = y;
+		}
+		color = here;
+	}
+	if (start <= y1) {
+		send(c, x, start, x, y1, color);
+	}
+}
+
+static void resolveSpan(void *ctx, int vertical, int line, int a, int b, int)
+{
+	Compositor *c = (Compositor *)ctx;
+	if (vertical) {
+		resolveColumn(c, line, a, b);
+	} else {
+		resolveRow(c, line, a, b);
+	}
+}
+
+static void resolveDisc(Compositor *c, int x, int y, int r)
+{
+	const uint8_t *rows = c->discRows[r];
+	for (int dy = -r; dy <= r; dy++) {
+		int w = rows[dy < 0 ? -dy : dy];
+		resolveRow(c, y + dy, x - w, x + w);
+	}
+}
+
+void compRefresh(Compositor *c, int x0, int y0, int x1, int y1)
+{
+	for (int y = y0; y <= y1; y++) {
+		resolveRow(c, y, x0, x1);
+	}
+}
+
+void compInit(Compositor *c, CompFill fill, void *ctx, int width, int height, uint16_t background)
+{
+	int i;
+	c->fill = fill;
+	c->ctx = ctx;
+	c->haveRows = 0;
+	for (i = 0; i < COMP_MAX_SPRITES; i++) {
+		c->sprites[i].visible = 0;
+	}
+	for (i = 0; i < COMP_MAX_OVERLAYS; i++) {
+		c->overlays[i].visible = 0;
+		c->overlays[i].mask = 0;
+	}
+	c->spans = 0;
+	c->pixels = 0;
+	compStaticBegin(c, width, height, background);
+	compStaticBuild(c);
+}
+
+void compStaticBegin(Compositor *c, int width, int height, uint16_t background)
+{
+	c->width = width > COMP_MAX_SIZE ? COMP_MAX_SIZE : width;
+	c->height = height > COMP_MAX_SIZE ? COMP_MAX_SIZE : height;
+	c->background = background;
+	c->numShapes = 0;
+	c->runs = 0;
+	c->numRuns = 0;
+}
+
+int compStaticRect(Compositor *c, int x0, int y0, int x1, int y1, uint16_t color)
+{
+	if (c->numShapes >= COMP_MAX_SHAPES) {
+		return 0;
+	}
+	CompShape *s = &c->shapes[c->numShapes++];
+	s->x0 = x0;
+	s->y0 = y0;
+	s->x1 = x1;
+	s->y1 = y1;
+	s->r = 0;
+	s->color = color;
+	return 1;
+}
+
+int compStaticDisc(Compositor *c, int cx, int cy, int r, uint16_t color)
+{
+	if (c->numShapes >= COMP_MAX_SHAPES || r < 1 || r > CRESCENT_MAX_RADIUS) {
+		return 0;
+	}
+	discRows(c, r);
+	CompShape *s = &c->shapes[c->numShapes++];
+	s->x0 = cx;
+	s->y0 = cy;
+	s->x1 = cx;
+	s->y1 = cy;
+	s->r = r;
+	s->color = color;
+	return 1;
+}
+
+static void putRun(uint8_t *p, int count, uint16_t color)
+{
+	p[0] = count & 0xFF;
+	p[1] = count >> 8;
+	p[2] = color & 0xFF;
+	p[3] = color >> 8;
+}
+
+int compStaticBuild(Compositor *c)
+{
+	uint8_t *buf = c->runBuf;
+	int n = 0, last = 0;
+	uint16_t lastColor = 0;
+
+	/* Row by row through the line buffer; a run carries on into the
+	   next row when the colour does, as in pre-rendered levels */
+	c->runs = 0;
+	for (int y = 0; y < c->height; y++) {
+		staticRow(c, y, 0, c->width - 1, c->line);
+		if (n > 0 && c->line[0] == lastColor && last < 0xFFFF) {
+			c->rowRun[y] = n - 1;
+			c->rowSkip[y] = last;
+		} else {
+			c->rowRun[y] = n;
+			c->rowSkip[y] = 0;
+		}
+		for (int x = 0; x < c->width; x++) {
+			if (n > 0 && c->line[x] == lastColor && last < 0xFFFF) {
+				last++;
+				continue;
+			}
+			if (n > 0) {
+				putRun(buf + (n - 1) * LEVEL_RUN_SIZE, last, lastColor);
+			}
+			if (n == COMP_MAX_RUNS) {
+				c->numRuns = 0;
+				return 0;
+			}
+			n++;
+			last = 1;
+			lastColor = c->line[x];
+		}
+	}
+	if (n > 0) {
+		putRun(buf + (n - 1) * LEVEL_RUN_SIZE, last, lastColor);
+	}
+	c->runs = buf;
+	c->numRuns = n;
+	return 1;
+}
+
+void compStaticRuns(Compositor *c, const uint8_t *runs, int numRuns)
+{
+	long pos = 0;
+	int i = 0;
+
+	c->runs = runs;
+	c->numRuns = numRuns;
+	for (int y = 0; y < c->height; y++) {
+		long start = (long)y * c->width;
+		while (i < numRuns && pos + runCount(runs, i) <= start) {
+			pos += runCount(runs, i++);
+		}
+		c->rowRun[y] = i;
+		c->rowSkip[y] = i < numRuns ? start - pos : 0;
+	}
+}
+
+int compStaticLevel(Compositor *c, const Level *lv)
+{
+	int i, ok = 1;
+
+	compStaticBegin(c, lv->width, lv->height, lv->background);
+	if (lv->numRuns > 0) {
+		compStaticRuns(c, lv->runs, lv->numRuns);
+		return 1;
+	}
+	for (i = 0; i < lv->numWalls; i++) {
+		const PhysBox *b = &lv->walls[i];
+		ok &= compStaticRect(c, b->x, b->y, b->x + b->w, b->y + b->h, lv->wallColor[i]);
+	}
+	for (i = 0; i < lv->numHoles; i++) {
+		const LevelZone *z = &lv->holes[i];
+		ok &= compStaticDisc(c, z->x, z->y, z->radius, z->color);
+	}
+	ok &= compStaticDisc(c, lv->goal.x, lv->goal.y, lv->goal.radius, lv->goal.color);
+	return compStaticBuild(c) && ok;
+}
+
+static int setSprite(Compositor *c, int id, int x, int y, int r, uint16_t color)
+{
+	if (id < 0 || id >= COMP_MAX_SPRITES || r < 1 || r > CRESCENT_MAX_RADIUS) {
+		return 0;
+	}
+	CompSprite *s = &c->sprites[id];
+	discRows(c, r);
+	s->x = x;
+	s->y = y;
+	s->r = r;
+	s->color = color;
+	s->visible = 1;
+	return 1;
+}
+
+void compSpritePlace(Compositor *c, int id, int x, int y, int r, uint16_t color)
+{
+	setSprite(c, id, x, y, r, color);
+}
+
+void compSpriteShow(Compositor *c, int id, int x, int y, int r, uint16_t color)
+{
+	if (id < 0 || id >= COMP_MAX_SPRITES) {
+		return;
+	}
+	CompSprite old = c->sprites[id];
+	if (old.visible && old.r == r && old.color == color) {
+		compSpriteMove(c, id, x, y);
+		return;
+	}
+	if (!setSprite(c, id, x, y, r, color)) {
+		return;
+	}
+	if (old.visible) {
+		resolveDisc(c, old.x, old.y, old.r);
+	}
+	resolveDisc(c, x, y, r);
+}
+
+void compSpriteMove(Compositor *c, int id, int x, int y)
+{
+	if (id < 0 || id >= COMP_MAX_SPRITES) {
+		return;
+	}
+	CompSprite *s = &c->sprites[id];
+	int ox = s->x, oy = s->y;
+	if (ox == x && oy == y) {
+		return;
+	}
+	s->x = x;
+	s->y = y;
+	if (s->visible) {
+		// only the two crescents change
+		crescentDiff(c->discRows[s->r], s->r, ox, oy, x, y, resolveSpan, c);
+	}
+}
+
+void compSpriteHide(Compositor *c, int id)
+{
+	if (id < 0 || id >= COMP_MAX_SPRITES || !c->sprites[id].visible) {
+		return;
+	}
+	CompSprite *s = &c->sprites[id];
+	s->visible = 0;
+	resolveDisc(c, s->x, s->y, s->r);
+}
+
+static void showOverlay(Compositor *c, int id, int x0, int y0, int x1, int y1, const uint16_t *mask, uint16_t color)
+{
+	if (id < 0 || id >= COMP_MAX_OVERLAYS) {
+		return;
+	}
+	CompRect *o = &c->overlays[id];
+	CompRect old = *o;
+	o->x0 = x0;
+	o->y0 = y0;
+	o->x1 = x1;
+	o->y1 = y1;
+	o->color = color;
+	o->mask = mask;
+	o->visible = 1;
+	if (old.visible) {
+		compRefresh(c, old.x0, old.y0, old.x1, old.y1);
+	}
+	compRefresh(c, x0, y0, x1, y1);
+}
+
+void compOverlayShow(Compositor *c, int id, int x0, int y0, int x1, int y1, uint16_t color)
+{
+	showOverlay(c, id, x0, y0, x1, y1, 0, color);
+}
+
+void compOverlayMask(Compositor *c, int id, int x0, int y0, int w, int h, const uint16_t *mask, uint16_t color)
+{
+	if (w < 1 || w > 16 || h < 1) {
+		return;
+	}
+	showOverlay(c, id, x0, y0, x0 + w - 1, y0 + h - 1, mask, color);
+}
+
+void compOverlayHide(Compositor *c, int id)
+{
+	if (id < 0 || id >= COMP_MAX_OVERLAYS || !c->overlays[id].visible) {
+		return;
+	}
+	CompRect *o = &c->overlays[id];
+	o->visible = 0;
+	compRefresh(c, o->x0, o->y0, o->x1, o->y1);
+}
@@ -0,0 +1,134 @@
+/* Labyrinth scene compositor
+ *
+ * The screen is three layers, bottom to top:
+ *
+ *   static   walls, holes and goal; rasterized once per level into
+ *            run-length rows in RAM (or the level's own pre-rendered
+ *            runs, straight from flash), with an index to the first
+ *            run of every row
+ *   sprites  the ball and anything else that moves, as discs
+ *   overlay  UI rectangles such as the pause marker, solid or
+ *            through a 1-bit mask such as the hint arrow
+ *
+ * Nothing is ever repaired by redrawing whole primitives. When a layer
+ * changes, only the pixels it touched are resolved again, top layer
+ * first, with the static layer sampled under them, and sent to the
+ * display as spans of one colour through the fill callback. A sprite
+ * move only resolves its two crescents (Crescent.h).
+ *
+ * If the static runs do not fit in COMP_MAX_RUNS the shapes are sampled
+ * directly instead, which is slower but gives the same pixels.
+ */
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <stdint.h>
+#include "Crescent.h"
+#include "Level.h"
+
+#define COMP_MAX_SIZE       320   /* pixels, either side */
+#define COMP_MAX_SHAPES     (LEVEL_MAX_WALLS + LEVEL_MAX_HOLES + 1)
+#define COMP_MAX_RUNS       4096  /* 16 KB */
+#define COMP_MAX_SPRITES    4
+#define COMP_MAX_OVERLAYS   4
+
+typedef void (*CompFill)(void *ctx, int x0, int y0, int x1, int y1, uint16_t color);
+
+typedef struct compShape {
+	int16_t x0;            /* rect: bounds, inclusive; disc: centre */
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+	int16_t r;             /* 0 for a rect */
+	uint16_t color;
+} CompShape;
+
+typedef struct compSprite {
+	int16_t x;             /* centre */
+	int16_t y;
+	int16_t r;
+	uint16_t color;
+	uint8_t visible;
+} CompSprite;
+
+typedef struct compRect {
+	int16_t x0;            /* inclusive */
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+	uint16_t color;
+	uint8_t visible;
+	const uint16_t *mask;  /* a row each, bit 0 at x0; 0 for solid */
+} CompRect;
+
+typedef struct compositor {
+	CompFill fill;
+	void *ctx;
+
+	/* Static layer */
+	int width;
+	int height;
+	uint16_t background;
+	CompShape shapes[COMP_MAX_SHAPES];
+	int numShapes;
+	const uint8_t *runs;   /* u16 count, u16 colour, as in Level.h; 0: sample the shapes */
+	int numRuns;
+	uint16_t rowRun[COMP_MAX_SIZE];   /* run holding the first pixel of each row */
+	uint16_t rowSkip[COMP_MAX_SIZE];  /* and how far into it that pixel is */
+	uint8_t runBuf[COMP_MAX_RUNS * LEVEL_RUN_SIZE];
+
+	/* Disc half-widths by radius, filled on first use */
+	uint8_t discRows[CRESCENT_MAX_RADIUS + 1][CRESCENT_MAX_RADIUS + 1];
+	uint32_t haveRows;
+
+	CompSprite sprites[COMP_MAX_SPRITES];
+	CompRect overlays[COMP_MAX_OVERLAYS];
+
+	/* One row being resolved */
+	uint16_t line[COMP_MAX_SIZE];
+
+	/* Totals, for measuring */
+	uint32_t spans;
+	uint32_t pixels;
+} Compositor;
+
+/* Empty scene: background only, no sprites or overlays */
+void compInit(Compositor *c, CompFill fill, void *ctx, int width, int height, uint16_t background);
+
+/* Start a new static layer; sprites and overlays are kept. Add the
+   shapes in paint order, then build. Nothing is drawn: the caller has
+   already painted the level. */
+void compStaticBegin(Compositor *c, int width, int height, uint16_t background);
+int compStaticRect(Compositor *c, int x0, int y0, int x1, int y1, uint16_t color);
+int compStaticDisc(Compositor *c, int cx, int cy, int r, uint16_t color);
+/* Rasterize the shapes into runs. Returns 0 if they did not fit, in
+   which case the shapes are sampled directly. */
+int compStaticBuild(Compositor *c);
+/* Use pre-rendered runs (count pixels, colour; rows may wrap) that
+   outlive the compositor, e.g. a level's */
+void compStaticRuns(Compositor *c, const uint8_t *runs, int numRuns);
+/* Static layer of a loaded level: its runs if it has them, else its
+   walls, holes and goal */
+int compStaticLevel(Compositor *c, const Level *lv);
+
+/* Colour of the static layer at a pixel */
+uint16_t compStaticPixel(const Compositor *c, int x, int y);
+
+/* Sprites, drawn in id order. Place records a sprite that is already
+   on screen without drawing it. */
+void compSpritePlace(Compositor *c, int id, int x, int y, int r, uint16_t color);
+void compSpriteShow(Compositor *c, int id, int x, int y, int r, uint16_t color);
+void compSpriteMove(Compositor *c, int id, int x, int y);
+void compSpriteHide(Compositor *c, int id);
+
+/* Overlay rectangles, inclusive, drawn in id order over everything */
+void compOverlayShow(Compositor *c, int id, int x0, int y0, int x1, int y1, uint16_t color);
+/* The same, only where the mask (h rows of up to 16 bits, kept by the
+   caller) has bits set */
+void compOverlayMask(Compositor *c, int id, int x0, int y0, int w, int h, const uint16_t *mask, uint16_t color);
+void compOverlayHide(Compositor *c, int id);
+
+/* Resolve and send a region again, e.g. after drawing over it directly */
+void compRefresh(Compositor *c, int x0, int y0, int x1, int y1);
+
+#endif
@@ -0,0 +1,79 @@
+#include "Crescent.h"
+
+void crescentDiscRows(int r, uint8_t *rows)
+{
+	/* the same walk as fillcircle(): each step paints the columns at
+	   +/-x over rows -y..y, with |x| shrinking as y grows, so row d is
+	   first reached by the widest column that covers it */
+	int x = -r, y = 0, err = 2 - 2 * r, e2;
+	int filled = -1;
+	do {
+		while (filled < y && filled < r) {
+			rows[++filled] = -x;
+		}
+		e2 = err;
+		if (e2 <= y) {
+			err += ++y * 2 + 1;
+			if (-x == y && e2 <= x) e2 = 0;
+		}
+		if (e2 > x) err += ++x * 2 + 1;
+	} while (x <= 0);
+}
+
+void crescentDiff(const uint8_t *rows, int r, int ox, int oy, int nx, int ny, CrescentSpan span, void *ctx)
+{
+	int dx = nx - ox, dy = ny - oy;
+	int vertical;
+	int oLine, oPos, nLine, nPos;
+
+	/* Walk lines across the direction of motion so that each line has
+	   at most two short spans: columns for a sideways move */
+	if (dx < 0) dx = -dx;
+	if (dy < 0) dy = -dy;
+	vertical = dx > dy;
+	oLine = vertical ? ox : oy;
+	oPos = vertical ? oy : ox;
+	nLine = vertical ? nx : ny;
+	nPos = vertical ? ny : nx;
+
+	int first = (oLine < nLine ? oLine : nLine) - r;
+	int last = (oLine > nLine ? oLine : nLine) + r;
+	for (int line = first; line <= last; line++) {
+		int od = line - oLine, nd = line - nLine;
+		int hasOld, hasNew;
+		int o0 = 0, o1 = -1, n0 = 0, n1 = -1;
+		if (od < 0) od = -od;
+		if (nd < 0) nd = -nd;
+		hasOld = od <= r;
+		hasNew = nd <= r;
+		if (hasOld) {
+			o0 = oPos - rows[od];
+			o1 = oPos + rows[od];
+		}
+		if (hasNew) {
+			n0 = nPos - rows[nd];
+			n1 = nPos + rows[nd];
+		}
+
+		if (!hasNew) {
+			span(ctx, vertical, line, o0, o1, 0);
+		} else if (!hasOld || o1 < n0 || n1 < o0) {
+			if (hasOld) {
+				span(ctx, vertical, line, o0, o1, 0);
+			}
+			span(ctx, vertical, line, n0, n1, 1);
+		} else {
+			/* overlapping: up to a crescent piece at each end */
+			if (o0 < n0) {
+				span(ctx, vertical, line, o0, n0 - 1, 0);
+			} else if (n0 < o0) {
+				span(ctx, vertical, line, n0, o0 - 1, 1);
+			}
+			if (o1 > n1) {
+				span(ctx, vertical, line, n1 + 1, o1, 0);
+			} else if (n1 > o1) {
+				span(ctx, vertical, line, o1 + 1, n1, 1);
+			}
+		}
+	}
+}
@@ -0,0 +1,33 @@
+/* Labyrinth ball crescents
+ *
+ * When the ball moves by a pixel or two, nearly all of its pixels stay
+ * the same colour. crescentDiff() works out, line by line, the pixels
+ * only the old disc covers (the trailing crescent) and the pixels only
+ * the new disc covers (the leading crescent), which are all that has to
+ * be redrawn. Lines run across the direction of motion, so a mostly
+ * horizontal move comes out as short columns and a mostly vertical one
+ * as short rows, at most two spans per line.
+ *
+ * Discs are rasterized exactly as the display driver's fillcircle()
+ * does, so nothing is left behind.
+ */
+#ifndef CRESCENT_H
+#define CRESCENT_H
+
+#include <stdint.h>
+
+#define CRESCENT_MAX_RADIUS   31
+
+/* One span of changed pixels: a..b on a line, which is a column
+   (x = line, y = a..b) if vertical, else a row. lead is 1 for pixels
+   only the new disc covers, 0 for pixels only the old one covers. */
+typedef void (*CrescentSpan)(void *ctx, int vertical, int line, int a, int b, int lead);
+
+/* Half-width of each row dy = 0..r of a disc as fillcircle() draws it */
+void crescentDiscRows(int r, uint8_t *rows);
+
+/* Report the pixels that differ between a disc of radius r at (ox,oy)
+   and the same disc at (nx,ny); rows from crescentDiscRows(r) */
+void crescentDiff(const uint8_t *rows, int r, int ox, int oy, int nx, int ny, CrescentSpan span, void *ctx);
+
+#endif
@@ -0,0 +1,60 @@
+#include "EventQueue.h"
+
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+void eventQueueInit(EventQueue *q)
+{
+	q->head = 0;
+	q->tail = 0;
+	q->dropped = 0;
+	eventResetStats(q);
+}
+
+int eventPost(EventQueue *q, int type, int arg, uint32_t now)
+{
+	unsigned int tail = q->tail;
+	if (tail - q->head == EVENT_QUEUE_SIZE) {
+		q->dropped++;
+		return 0;
+	}
+	Event *e = &q->buf[tail & EVENT_QUEUE_MASK];
+	e->type = type;
+	e->arg = arg;
+	e->time = now;
+	// publish only once the slot is filled in
+	q->tail = tail + 1;
+	return 1;
+}
+
+int eventGet(EventQueue *q, Event *e, uint32_t now)
+{
+	unsigned int head = q->head;
+	if (head == q->tail) {
+		return 0;
+	}
+	*e = q->buf[head & EVENT_QUEUE_MASK];
+	q->head = head + 1;
+
+	uint32_t latency = now - e->time;
+	q->count++;
+	q->latencySum += latency;
+	if (latency > q->latencyMax) {
+		q->latencyMax = latency;
+	}
+	return 1;
+}
+
+uint32_t eventLatencyAvg(const EventQueue *q)
+{
+	if (q->count == 0) {
+		return 0;
+	}
+	return q->latencySum / q->count;
+}
+
+void eventResetStats(EventQueue *q)
+{
+	q->count = 0;
+	q->latencySum = 0;
+	q->latencyMax = 0;
+}
@@ -0,0 +1,56 @@
+/* Labyrinth deferred event queue
+ *
+ * Interrupt handlers post small timestamped events here instead of doing
+ * any drawing, bus traffic or waiting themselves; the main loop takes them
+ * off later. The queue is a single-producer/single-consumer ring, so every
+ * ISR that posts to one queue must run at the same NVIC priority (the mbed
+ * default) so that they cannot preempt each other.
+ *
+ * Timestamps are in microseconds (us_ticker_read() on target); the queue
+ * keeps post-to-dispatch latency statistics so input lag can be measured.
+ */
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <stdint.h>
+
+#define EVENT_QUEUE_SIZE 16   /* must be a power of two */
+
+/* Event types used by the Labyrinth programs */
+#define EVENT_TOUCH      1    /* touch panel pen-down interrupt */
+
+typedef struct event {
+	uint8_t type;
+	uint16_t arg;
+	uint32_t time;             /* when it was posted */
+} Event;
+
+typedef struct eventQueue {
+	Event buf[EVENT_QUEUE_SIZE];
+	volatile unsigned int head;    /* written by the consumer only */
+	volatile unsigned int tail;    /* written by the producer only */
+	volatile unsigned int dropped; /* posts lost to a full queue */
+
+	/* Latency statistics, updated by eventGet() */
+	unsigned int count;
+	uint32_t latencySum;
+	uint32_t latencyMax;
+} EventQueue;
+
+void eventQueueInit(EventQueue *q);
+
+/* Post from an interrupt handler. Returns 0 if the queue was full. */
+int eventPost(EventQueue *q, int type, int arg, uint32_t now);
+
+/* Take the oldest event; now is used for the latency statistics.
+   Returns 0 if the queue was empty. */
+int eventGet(EventQueue *q, Event *e, uint32_t now);
+
+/* Average post-to-dispatch latency in microseconds */
+uint32_t eventLatencyAvg(const EventQueue *q);
+
+/* Clear the latency statistics. dropped belongs to the producer and
+   keeps counting; take differences of it instead. */
+void eventResetStats(EventQueue *q);
+
+#endif
@@ -0,0 +1,185 @@
+#include "FlowField.h"
+
+#define FLAG_BLOCKED   1
+#define FLAG_QUEUED    2
+
+const int8_t flowStepX[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+const int8_t flowStepY[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+
+void flowInit(FlowField *f, int width, int height)
+{
+	f->cols = (width + (1 << FLOW_CELL_SHIFT) - 1) >> FLOW_CELL_SHIFT;
+	f->rows = (height + (1 << FLOW_CELL_SHIFT) - 1) >> FLOW_CELL_SHIFT;
+	if (f->cols * f->rows > FLOW_MAX_CELLS) {
+		f->rows = FLOW_MAX_CELLS / f->cols;
+	}
+	for (int i = 0; i < f->cols * f->rows; i++) {
+		f->dist[i] = FLOW_FAR;
+		f->flags[i] = 0;
+	}
+	f->head = 0;
+	f->count = 0;
+	f->visits = 0;
+}
+
+static int cellOf(const FlowField *f, int x, int y)
+{
+	int c = x >> FLOW_CELL_SHIFT;
+	int r = y >> FLOW_CELL_SHIFT;
+	if (x < 0 || y < 0 || c >= f->cols || r >= f->rows) {
+		return -1;
+	}
+	return r * f->cols + c;
+}
+
+/* Cell next to i in direction d, or -1 off the edge */
+static int neighbour(const FlowField *f, int i, int d)
+{
+	int c = i % f->cols + flowStepX[d];
+	int r = i / f->cols + flowStepY[d];
+	if (c < 0 || r < 0 || c >= f->cols || r >= f->rows) {
+		return -1;
+	}
+	return r * f->cols + c;
+}
+
+static void push(FlowField *f, int i)
+{
+	if (f->flags[i] & FLAG_QUEUED) {
+		return;
+	}
+	int tail = f->head + f->count;
+	if (tail >= FLOW_MAX_CELLS) {
+		tail -= FLOW_MAX_CELLS;
+	}
+	f->queue[tail] = i;
+	f->count++;
+	f->flags[i] |= FLAG_QUEUED;
+}
+
+void flowBlock(FlowField *f, int x, int y)
+{
+	int i = cellOf(f, x, y);
+	if (i >= 0) {
+		f->flags[i] |= FLAG_BLOCKED;
+	}
+}
+
+void flowAddGoal(FlowField *f, int x, int y)
+{
+	int i = cellOf(f, x, y);
+	if (i >= 0 && !(f->flags[i] & FLAG_BLOCKED)) {
+		f->dist[i] = 0;
+		push(f, i);
+	}
+}
+
+int flowUpdate(FlowField *f, int budget)
+{
+	while (f->count > 0 && budget-- > 0) {
+		int i = f->queue[f->head];
+		if (++f->head == FLOW_MAX_CELLS) {
+			f->head = 0;
+		}
+		f->count--;
+		f->flags[i] &= ~FLAG_QUEUED;
+		f->visits++;
+		for (int d = 0; d < 8; d += 2) {
+			int n = neighbour(f, i, d);
+			if (n >= 0 && !(f->flags[n] & FLAG_BLOCKED) && f->dist[i] + 1 < f->dist[n]) {
+				f->dist[n] = f->dist[i] + 1;
+				push(f, n);
+			}
+		}
+	}
+	return f->count == 0;
+}
+
+static int passable(const FlowField *f, int i, int d)
+{
+	int n = neighbour(f, i, d);
+	return n >= 0 && !(f->flags[n] & FLAG_BLOCKED);
+}
+
+/* Way out of blocked cell i: the open side nearest the goal */
+static int leaveBlocked(const FlowField *f, int i)
+{
+	int best = FLOW_NONE;
+	int bestDist = FLOW_FAR;
+	for (int d = 0; d < 8; d += 2) {
+		int n = neighbour(f, i, d);
+		if (n >= 0 && !(f->flags[n] & FLAG_BLOCKED) && f->dist[n] < bestDist) {
+			best = d;
+			bestDist = f->dist[n];
+		}
+	}
+	return best;
+}
+
+int flowDirection(const FlowField *f, int x, int y)
+{
+	int i = cellOf(f, x, y);
+	if (i < 0) {
+		return FLOW_NONE;
+	}
+	if (f->flags[i] & FLAG_BLOCKED) {
+		return leaveBlocked(f, i);
+	}
+	if (f->dist[i] == FLOW_FAR || f->dist[i] == 0) {
+		return FLOW_NONE;
+	}
+	/* a diagonal is two steps, so it wins over a side only if it is
+	   really shorter; sides are looked at first and win ties */
+	int best = FLOW_NONE;
+	int bestDist = f->dist[i];
+	for (int k = 0; k < 8; k++) {
+		int d = (k < 4) ? k * 2 : (k - 4) * 2 + 1;
+		if (!passable(f, i, d)) {
+			continue;
+		}
+		if ((d & 1) && !(passable(f, i, d - 1) && passable(f, i, (d + 1) & 7))) {
+			continue;
+		}
+		int n = neighbour(f, i, d);
+		int steps = (d & 1) ? 2 : 1;
+		if (f->dist[n] != FLOW_FAR && f->dist[n] + steps <= f->dist[i] && f->dist[n] < bestDist) {
+			best = d;
+			bestDist = f->dist[n];
+		}
+	}
+	return best;
+}
+
+/* Arrow pointing east: a shaft and a head, in 1/256 px about the centre */
+static int arrowPixel(int u, int v)
+{
+	int av = v < 0 ? -v : v;
+	if (u >= -5 * 256 && u <= 256 && av <= 320) {
+		return 1;
+	}
+	return u >= -128 && u <= 5 * 256 && av <= 5 * 256 - u;
+}
+
+void flowArrow(int dir, uint16_t *rows)
+{
+	/* cos and sin of dir * 45 degrees, Q8 */
+	static const int16_t cosQ8[8] = { 256, 181, 0, -181, -256, -181, 0, 181 };
+	static const int16_t sinQ8[8] = { 0, 181, 256, 181, 0, -181, -256, -181 };
+	int half = FLOW_ARROW_SIZE / 2;
+
+	for (int y = 0; y < FLOW_ARROW_SIZE; y++) {
+		rows[y] = 0;
+		if (dir < 0 || dir > 7) {
+			continue;
+		}
+		for (int x = 0; x < FLOW_ARROW_SIZE; x++) {
+			int dx = x - half, dy = y - half;
+			/* turn the pixel back to the east-pointing arrow */
+			int u = dx * cosQ8[dir] + dy * sinQ8[dir];
+			int v = -dx * sinQ8[dir] + dy * cosQ8[dir];
+			if (arrowPixel(u, v)) {
+				rows[y] |= 1 << x;
+			}
+		}
+	}
+}
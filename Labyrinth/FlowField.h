@@ -0,0 +1,81 @@
+/* Labyrinth flow field
+ *
+ * Distance to the goal from every 8x8 px cell of the level, found by a
+ * breadth-first search out from the goal over the open cells, so that
+ * the way to go from anywhere is "to the neighbour nearest the goal".
+ * The hint arrow reads it.
+ *
+ * The search is incremental: cells are relaxed off a queue a budget at
+ * a time, so building the field can be spread over frames. The cells
+ * are blocked first and the goal set last; a level that changes needs
+ * a new field.
+ *
+ * Memory is fixed: 5 bytes per cell, 6 KB for 320x240.
+ */
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include <stdint.h>
+
+#define FLOW_CELL_SHIFT   3       /* 8 px cells */
+#define FLOW_MAX_CELLS    1200    /* 320x240 */
+#define FLOW_FAR          0xFFFF  /* no way to the goal (yet) */
+
+/* Directions, clockwise from east on screen (y grows down) */
+#define FLOW_NONE         -1
+#define FLOW_EAST         0
+#define FLOW_SOUTH_EAST   1
+#define FLOW_SOUTH        2
+#define FLOW_SOUTH_WEST   3
+#define FLOW_WEST         4
+#define FLOW_NORTH_WEST   5
+#define FLOW_NORTH        6
+#define FLOW_NORTH_EAST   7
+
+/* One cell's step in each direction */
+extern const int8_t flowStepX[8];
+extern const int8_t flowStepY[8];
+
+/* Arrow masks */
+#define FLOW_ARROW_SIZE   11      /* pixels square, centred */
+
+typedef struct flowField {
+	int cols;
+	int rows;
+
+	uint16_t dist[FLOW_MAX_CELLS];    /* steps to the goal */
+	uint8_t flags[FLOW_MAX_CELLS];
+
+	/* Cells waiting to be relaxed, a ring; each is queued once at most */
+	uint16_t queue[FLOW_MAX_CELLS];
+	int head;
+	int count;
+
+	/* Cells relaxed so far, for measuring */
+	uint32_t visits;
+} FlowField;
+
+/* Every cell of a width x height pixel level open, with no goal */
+void flowInit(FlowField *f, int width, int height);
+
+/* Block the cell holding pixel x,y, before the goal is set */
+void flowBlock(FlowField *f, int x, int y);
+
+/* Make the cell holding pixel x,y a goal (distance 0) */
+void flowAddGoal(FlowField *f, int x, int y);
+
+/* Relax at most budget cells; returns 1 once nothing is left to do and
+   the distances are final */
+int flowUpdate(FlowField *f, int budget);
+
+/* Way to go from pixel x,y: the open neighbour (diagonals only past two
+   open sides) nearest the goal, or FLOW_NONE at the goal or when there
+   is no way. The marble's centre can be in a blocked cell, at its edge
+   next to an open one; from there it is the open side nearest the goal. */
+int flowDirection(const FlowField *f, int x, int y);
+
+/* 1-bit arrow pointing in direction dir, FLOW_ARROW_SIZE rows with bit
+   0 the leftmost pixel */
+void flowArrow(int dir, uint16_t *rows);
+
+#endif
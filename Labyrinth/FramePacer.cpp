@@ -0,0 +1,85 @@
+#include "FramePacer.h"
+
+void frameInit(FramePacer *f, uint32_t tickUs, int ticksPerFrame)
+{
+	f->tickUs = tickUs;
+	f->ticksPerFrame = ticksPerFrame > 0 ? ticksPerFrame : 1;
+	f->ticks = 0;
+	f->ticksDone = 0;
+	f->deadline = f->ticksPerFrame;
+	f->frameStart = 0;
+	frameResetStats(f);
+}
+
+void frameTick(FramePacer *f)
+{
+	f->ticks = f->ticks + 1;
+}
+
+int frameDue(const FramePacer *f)
+{
+	/* wrap-safe: ticks has reached the deadline */
+	return (int32_t)(f->ticks - f->deadline) >= 0;
+}
+
+int frameBegin(FramePacer *f, uint32_t now)
+{
+	uint32_t ticks = f->ticks;
+	int steps = ticks - f->ticksDone;
+
+	f->ticksDone = ticks;
+	f->frameStart = now;
+	return steps;
+}
+
+void frameEnd(FramePacer *f, uint32_t now)
+{
+	uint32_t work = now - f->frameStart;
+	uint32_t ticks = f->ticks;
+
+	f->frames++;
+	f->lastWork = work;
+	f->workSum += work;
+	if (work > f->workMax) {
+		f->workMax = work;
+	}
+
+	f->deadline += f->ticksPerFrame;
+	if ((int32_t)(ticks - f->deadline) >= 0) {
+		/* overran: drop the deadlines already gone and wait for the
+		   next one, rather than rendering frames back to back */
+		uint32_t missed = (ticks - f->deadline) / f->ticksPerFrame + 1;
+		f->late++;
+		f->skipped += missed;
+		f->deadline += missed * f->ticksPerFrame;
+	}
+}
+
+void frameRestart(FramePacer *f, uint32_t now)
+{
+	uint32_t ticks = f->ticks;
+	f->ticksDone = ticks;
+	f->deadline = ticks + f->ticksPerFrame;
+	f->frameStart = now;
+}
+
+uint32_t frameWorkAvg(const FramePacer *f)
+{
+	return f->frames ? f->workSum / f->frames : 0;
+}
+
+int frameLoad(const FramePacer *f)
+{
+	uint32_t budget = f->tickUs * f->ticksPerFrame;
+	return budget ? frameWorkAvg(f) * 100 / budget : 0;
+}
+
+void frameResetStats(FramePacer *f)
+{
+	f->frames = 0;
+	f->late = 0;
+	f->skipped = 0;
+	f->workSum = 0;
+	f->workMax = 0;
+	f->lastWork = 0;
+}
@@ -0,0 +1,69 @@
+/* Labyrinth frame pacer
+ *
+ * Splits the main loop into a fixed physics tick and a render frame
+ * every ticksPerFrame ticks. A timer interrupt calls frameTick() once
+ * per tick and does nothing else. The main loop renders a frame, calls
+ * frameEnd(), sleeps (WFI) until frameDue(), then calls frameBegin(),
+ * which returns how many physics steps to run. The marble moves by
+ * ticks that really happened, whatever a frame cost, and the CPU
+ * sleeps instead of spinning out a fixed wait after the work.
+ *
+ * A frame whose work runs past the next deadline is late. The deadlines
+ * it overran are skipped rather than rendered back to back, so the
+ * pacer stays in phase with the tick. Both are counted.
+ *
+ * Times are microseconds from a free-running counter (us_ticker_read()
+ * on target) and are only used for the statistics.
+ */
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <stdint.h>
+
+typedef struct framePacer {
+	uint32_t tickUs;           /* tick period */
+	int ticksPerFrame;
+
+	volatile uint32_t ticks;   /* written by frameTick() only */
+	uint32_t ticksDone;        /* ticks handed out by frameBegin() */
+	uint32_t deadline;         /* tick the next frame is due at */
+
+	/* Statistics */
+	uint32_t frames;
+	uint32_t late;             /* frames whose work overran the next deadline */
+	uint32_t skipped;          /* deadlines dropped because of them */
+	uint32_t frameStart;       /* when the current frame began, us */
+	uint32_t workSum;          /* frameBegin() to frameEnd(), us */
+	uint32_t workMax;
+	uint32_t lastWork;
+} FramePacer;
+
+void frameInit(FramePacer *f, uint32_t tickUs, int ticksPerFrame);
+
+/* From the timer interrupt, every tickUs */
+void frameTick(FramePacer *f);
+
+/* Non-zero once the next frame is due */
+int frameDue(const FramePacer *f);
+
+/* Start a frame. Returns the ticks since the previous one, i.e. the
+   physics steps to run. */
+int frameBegin(FramePacer *f, uint32_t now);
+
+/* The frame's work is done: time it and set the next deadline */
+void frameEnd(FramePacer *f, uint32_t now);
+
+/* Forget the ticks and time that passed since the last frame, after
+   blocking work such as a screen change, and make the next frame due
+   a frame from now */
+void frameRestart(FramePacer *f, uint32_t now);
+
+/* Average work per frame, us, and the share of the frame budget it
+   used in percent */
+uint32_t frameWorkAvg(const FramePacer *f);
+int frameLoad(const FramePacer *f);
+
+/* Clear the statistics */
+void frameResetStats(FramePacer *f);
+
+#endif
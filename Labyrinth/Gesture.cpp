@@ -0,0 +1,190 @@
+#include "Gesture.h"
+
+#define GESTURE_IDLE      0
+#define GESTURE_PRESSED   1
+#define GESTURE_DRAGGING  2
+#define GESTURE_HELD      3    /* long press reported, not moved since */
+
+static int absInt(int v)
+{
+	return (v < 0) ? -v : v;
+}
+
+static int isqrt(int v)
+{
+	int r = 0;
+	int bit = 1 << 30;
+
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (v >= r + bit) {
+			v -= r + bit;
+			r = (r >> 1) + bit;
+		} else {
+			r >>= 1;
+		}
+		bit >>= 2;
+	}
+	return r;
+}
+
+static void emit(Gesture *out, int type, int x, int y, int dx, int dy, uint32_t now)
+{
+	out->type = type;
+	out->x = x;
+	out->y = y;
+	out->dx = dx;
+	out->dy = dy;
+	out->direction = 0;
+	out->velocity = 0;
+	out->time = now;
+}
+
+static void pushSample(GestureRecognizer *g, int x, int y, uint32_t now)
+{
+	g->histX[g->histNext] = x;
+	g->histY[g->histNext] = y;
+	g->histT[g->histNext] = now;
+	g->histNext = (g->histNext + 1) % GESTURE_HISTORY;
+	if (g->histCount < GESTURE_HISTORY) {
+		g->histCount++;
+	}
+}
+
+/* Speed and direction between the newest sample and the oldest one still
+   inside the velocity window */
+static void releaseVelocity(const GestureRecognizer *g, int *velocity, int *direction)
+{
+	int newest = (g->histNext + GESTURE_HISTORY - 1) % GESTURE_HISTORY;
+	int oldest = newest;
+	int i, dx, dy, dist;
+	uint32_t dt;
+
+	for (i = 1; i < g->histCount; i++) {
+		int k = (newest + GESTURE_HISTORY - i) % GESTURE_HISTORY;
+		if (g->histT[newest] - g->histT[k] > g->velocityUs) {
+			break;
+		}
+		oldest = k;
+	}
+	dx = g->histX[newest] - g->histX[oldest];
+	dy = g->histY[newest] - g->histY[oldest];
+	dt = g->histT[newest] - g->histT[oldest];
+	if (dt == 0) {
+		*velocity = 0;
+	} else {
+		dist = isqrt(dx*dx + dy*dy);
+		*velocity = (int)((int64_t)dist * 1000000 / dt);
+	}
+	if (absInt(dx) >= absInt(dy)) {
+		*direction = (dx >= 0) ? GESTURE_RIGHT : GESTURE_LEFT;
+	} else {
+		*direction = (dy >= 0) ? GESTURE_DOWN : GESTURE_UP;
+	}
+}
+
+void gestureInit(GestureRecognizer *g)
+{
+	g->slop = 8;
+	g->maxTapUs = 300000;
+	g->doubleTapUs = 300000;
+	g->longPressUs = 700000;
+	g->velocityUs = 100000;
+	g->swipeVelocity = 300;
+
+	g->state = GESTURE_IDLE;
+	g->histCount = 0;
+	g->histNext = 0;
+	g->tapValid = 0;
+}
+
+int gestureActive(const GestureRecognizer *g)
+{
+	return g->state != GESTURE_IDLE;
+}
+
+int gestureUpdate(GestureRecognizer *g, int touched, int x, int y, uint32_t now, Gesture *out)
+{
+	int dx, dy;
+
+	if (touched) {
+		if (g->state == GESTURE_IDLE) {
+			g->state = GESTURE_PRESSED;
+			g->startX = x;
+			g->startY = y;
+			g->startTime = now;
+			g->lastX = x;
+			g->lastY = y;
+			g->histCount = 0;
+			g->histNext = 0;
+			pushSample(g, x, y, now);
+			return 0;
+		}
+		pushSample(g, x, y, now);
+		dx = x - g->startX;
+		dy = y - g->startY;
+
+		if (g->state != GESTURE_DRAGGING && (absInt(dx) > g->slop || absInt(dy) > g->slop)) {
+			g->state = GESTURE_DRAGGING;
+		} else if (g->state == GESTURE_PRESSED && now - g->startTime >= g->longPressUs) {
+			g->state = GESTURE_HELD;
+			emit(out, GESTURE_LONG_PRESS, g->startX, g->startY, dx, dy, now);
+			return 1;
+		}
+		if (g->state == GESTURE_DRAGGING && (x != g->lastX || y != g->lastY)) {
+			g->lastX = x;
+			g->lastY = y;
+			emit(out, GESTURE_DRAG, x, y, dx, dy, now);
+			return 1;
+		}
+		return 0;
+	}
+
+	if (g->state == GESTURE_IDLE) {
+		return 0;
+	}
+	/* the release sample carries no position; use the last pressed one */
+	x = g->histX[(g->histNext + GESTURE_HISTORY - 1) % GESTURE_HISTORY];
+	y = g->histY[(g->histNext + GESTURE_HISTORY - 1) % GESTURE_HISTORY];
+	dx = x - g->startX;
+	dy = y - g->startY;
+
+	if (g->state == GESTURE_PRESSED) {
+		g->state = GESTURE_IDLE;
+		if (now - g->startTime > g->maxTapUs) {
+			return 0;
+		}
+		if (g->tapValid && g->startTime - g->tapTime <= g->doubleTapUs
+		    && absInt(g->startX - g->tapX) <= 2*g->slop && absInt(g->startY - g->tapY) <= 2*g->slop) {
+			g->tapValid = 0;
+			emit(out, GESTURE_DOUBLE_TAP, g->startX, g->startY, dx, dy, now);
+			return 1;
+		}
+		g->tapValid = 1;
+		g->tapX = g->startX;
+		g->tapY = g->startY;
+		g->tapTime = now;
+		emit(out, GESTURE_TAP, g->startX, g->startY, dx, dy, now);
+		return 1;
+	}
+	if (g->state == GESTURE_DRAGGING) {
+		int velocity, direction;
+		g->state = GESTURE_IDLE;
+		g->tapValid = 0;
+		releaseVelocity(g, &velocity, &direction);
+		if (velocity >= g->swipeVelocity) {
+			emit(out, GESTURE_SWIPE, x, y, dx, dy, now);
+			out->direction = direction;
+			out->velocity = velocity;
+		} else {
+			emit(out, GESTURE_DRAG_END, x, y, dx, dy, now);
+		}
+		return 1;
+	}
+	/* released after a long press */
+	g->state = GESTURE_IDLE;
+	g->tapValid = 0;
+	return 0;
+}
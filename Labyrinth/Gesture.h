@@ -0,0 +1,89 @@
+/* Labyrinth touch gestures
+ *
+ * Turns a stream of timestamped touch samples (from MYTOUCH, STMPE610 or
+ * anything else that reports pressed/x/y) into tap, double tap, long
+ * press, drag and swipe events. Memory is fixed (a short sample history
+ * for the release velocity) and all of the math is integer.
+ *
+ * Feed every sample while the panel is pressed, then one sample with
+ * touched = 0 when it is released; a long press is only seen while
+ * samples keep coming. Coordinates are screen pixels, times are
+ * microseconds (us_ticker_read() on target).
+ *
+ * A tap is reported as soon as the finger lifts; if a second tap follows
+ * close enough it is reported as GESTURE_DOUBLE_TAP instead of a second
+ * GESTURE_TAP.
+ */
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <stdint.h>
+
+#define GESTURE_NONE        0
+#define GESTURE_TAP         1
+#define GESTURE_DOUBLE_TAP  2
+#define GESTURE_LONG_PRESS  3
+#define GESTURE_DRAG        4    /* finger moved while pressed */
+#define GESTURE_DRAG_END    5    /* released slowly after a drag */
+#define GESTURE_SWIPE       6    /* released quickly after a drag */
+
+/* Swipe directions, screen axes (y grows downwards) */
+#define GESTURE_RIGHT       0
+#define GESTURE_DOWN        1
+#define GESTURE_LEFT        2
+#define GESTURE_UP          3
+
+#define GESTURE_HISTORY     8    /* samples kept for the release velocity */
+
+typedef struct gesture {
+	int type;
+	int x;                 /* where it happened */
+	int y;
+	int dx;                /* movement since the touch went down */
+	int dy;
+	int direction;         /* GESTURE_SWIPE only */
+	int velocity;          /* GESTURE_SWIPE only, pixels per second */
+	uint32_t time;
+} Gesture;
+
+typedef struct gestureRecognizer {
+	/* Thresholds, set by gestureInit() and free to change afterwards */
+	int slop;              /* pixels a tap or long press may wander */
+	uint32_t maxTapUs;     /* longest touch that still counts as a tap */
+	uint32_t doubleTapUs;  /* longest gap between the taps of a double tap */
+	uint32_t longPressUs;
+	uint32_t velocityUs;   /* release velocity is measured over this window */
+	int swipeVelocity;     /* pixels per second at release to be a swipe */
+
+	/* Current touch */
+	int state;
+	int startX;
+	int startY;
+	uint32_t startTime;
+	int lastX;             /* position of the last GESTURE_DRAG */
+	int lastY;
+
+	/* Recent samples of the current touch, oldest first once wrapped */
+	int histX[GESTURE_HISTORY];
+	int histY[GESTURE_HISTORY];
+	uint32_t histT[GESTURE_HISTORY];
+	int histCount;
+	int histNext;
+
+	/* Previous tap, for double taps */
+	int tapValid;
+	int tapX;
+	int tapY;
+	uint32_t tapTime;
+} GestureRecognizer;
+
+/* Defaults suited to the 320x240 resistive panels */
+void gestureInit(GestureRecognizer *g);
+
+/* Feed one sample. Returns 1 and fills *out if it completed a gesture. */
+int gestureUpdate(GestureRecognizer *g, int touched, int x, int y, uint32_t now, Gesture *out);
+
+/* Nonzero while a touch is in progress */
+int gestureActive(const GestureRecognizer *g);
+
+#endif
@@ -0,0 +1,160 @@
+#include "Grid.h"
+
+static int clampCell(int v, int n)
+{
+	if (v < 0) {
+		return 0;
+	} else if (v > n - 1) {
+		return n - 1;
+	}
+	return v;
+}
+
+void gridInit(Grid *g, int width, int height)
+{
+	g->cellShift = GRID_CELL_SHIFT;
+	/* grow the cells until the grid fits the budget */
+	for (;;) {
+		g->cols = (width + (1 << g->cellShift) - 1) >> g->cellShift;
+		g->rows = (height + (1 << g->cellShift) - 1) >> g->cellShift;
+		if (g->cols * g->rows <= GRID_MAX_CELLS) {
+			break;
+		}
+		g->cellShift++;
+	}
+	g->numItems = 0;
+	g->numRefs = -1;
+	g->stamp = 0;
+}
+
+static int addItem(Grid *g, int kind, int index, int x0, int y0, int x1, int y1)
+{
+	GridItem *it;
+
+	if (g->numItems == GRID_MAX_ITEMS) {
+		return 0;
+	}
+	it = &g->items[g->numItems];
+	it->x0 = x0;
+	it->y0 = y0;
+	it->x1 = x1;
+	it->y1 = y1;
+	it->kind = kind;
+	it->index = index;
+	g->seen[g->numItems] = 0;
+	g->numItems++;
+	g->numRefs = -1;
+	return 1;
+}
+
+int gridAddBox(Grid *g, int kind, int index, int x, int y, int w, int h)
+{
+	return addItem(g, kind, index, x, y, x + w, y + h);
+}
+
+int gridAddCircle(Grid *g, int kind, int index, int cx, int cy, int r)
+{
+	return addItem(g, kind, index, cx - r, cy - r, cx + r, cy + r);
+}
+
+int gridBuild(Grid *g)
+{
+	int cells = g->cols * g->rows;
+	int i, cx, cy, total = 0;
+
+	for (i = 0; i <= cells; i++) {
+		g->cellStart[i] = 0;
+	}
+	/* count the items per cell, shifted by one so that the prefix sum
+	   leaves each cell's start in place */
+	for (i = 0; i < g->numItems; i++) {
+		const GridItem *it = &g->items[i];
+		int c0 = clampCell(it->x0 >> g->cellShift, g->cols);
+		int c1 = clampCell(it->x1 >> g->cellShift, g->cols);
+		int r0 = clampCell(it->y0 >> g->cellShift, g->rows);
+		int r1 = clampCell(it->y1 >> g->cellShift, g->rows);
+		total += (c1 - c0 + 1) * (r1 - r0 + 1);
+		if (total > GRID_MAX_REFS) {
+			g->numRefs = -1;
+			return 0;
+		}
+		for (cy = r0; cy <= r1; cy++) {
+			for (cx = c0; cx <= c1; cx++) {
+				g->cellStart[cy * g->cols + cx + 1]++;
+			}
+		}
+	}
+	for (i = 0; i < cells; i++) {
+		g->cellStart[i + 1] += g->cellStart[i];
+	}
+	/* fill, using cellStart as the write cursor, then shift it back */
+	for (i = 0; i < g->numItems; i++) {
+		const GridItem *it = &g->items[i];
+		int c0 = clampCell(it->x0 >> g->cellShift, g->cols);
+		int c1 = clampCell(it->x1 >> g->cellShift, g->cols);
+		int r0 = clampCell(it->y0 >> g->cellShift, g->rows);
+		int r1 = clampCell(it->y1 >> g->cellShift, g->rows);
+		for (cy = r0; cy <= r1; cy++) {
+			for (cx = c0; cx <= c1; cx++) {
+				g->refs[g->cellStart[cy * g->cols + cx]++] = i;
+			}
+		}
+	}
+	for (i = cells; i > 0; i--) {
+		g->cellStart[i] = g->cellStart[i - 1];
+	}
+	g->cellStart[0] = 0;
+	g->numRefs = total;
+	return 1;
+}
+
+static int overlaps(const GridItem *it, int x0, int y0, int x1, int y1)
+{
+	return it->x0 <= x1 && it->x1 >= x0 && it->y0 <= y1 && it->y1 >= y0;
+}
+
+int gridQuery(Grid *g, int x0, int y0, int x1, int y1, int mask, uint16_t *out, int max)
+{
+	int n = 0;
+	int i, k, cx, cy;
+
+	if (g->numRefs < 0) {
+		for (i = 0; i < g->numItems && n < max; i++) {
+			if ((g->items[i].kind & mask) && overlaps(&g->items[i], x0, y0, x1, y1)) {
+				out[n++] = i;
+			}
+		}
+		return n;
+	}
+
+	if (++g->stamp == 0) {
+		/* wrapped: forget every old mark */
+		for (i = 0; i < g->numItems; i++) {
+			g->seen[i] = 0;
+		}
+		g->stamp = 1;
+	}
+	int c0 = clampCell(x0 >> g->cellShift, g->cols);
+	int c1 = clampCell(x1 >> g->cellShift, g->cols);
+	int r0 = clampCell(y0 >> g->cellShift, g->rows);
+	int r1 = clampCell(y1 >> g->cellShift, g->rows);
+	for (cy = r0; cy <= r1; cy++) {
+		for (cx = c0; cx <= c1; cx++) {
+			int cell = cy * g->cols + cx;
+			for (k = g->cellStart[cell]; k < g->cellStart[cell + 1]; k++) {
+				i = g->refs[k];
+				if (g->seen[i] == g->stamp) {
+					continue;
+				}
+				g->seen[i] = g->stamp;
+				if ((g->items[i].kind & mask) && overlaps(&g->items[i], x0, y0, x1, y1)) {
+					if (n == max) {
+						return n;
+					}
+					out[n++] = i;
+				}
+			}
+		}
+	}
+	return n;
+}
@@ -0,0 +1,69 @@
+/* Labyrinth spatial index
+ *
+ * A uniform grid over the maze, built once per level, that lists which
+ * walls, holes and goals touch each cell. Collision and proximity
+ * queries then only look at the items in the few cells around the ball
+ * instead of every item in the level.
+ *
+ * Storage is fixed size: items are added, gridBuild() packs the per-cell
+ * lists into one array (cell i owns refs[cellStart[i] .. cellStart[i+1]-1])
+ * and the grid is read-only from then on.
+ */
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdint.h>
+
+#define GRID_MAX_ITEMS    512
+#define GRID_MAX_REFS     2048
+#define GRID_MAX_CELLS    512     /* 320x240 at 16 px needs 300 */
+#define GRID_CELL_SHIFT   4       /* 16 px cells */
+
+/* Item kinds, also used as query masks */
+#define GRID_WALL         1
+#define GRID_HOLE         2
+#define GRID_GOAL         4
+
+typedef struct gridItem {
+	int16_t x0;            /* bounds, pixels, inclusive */
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+	uint8_t kind;
+	uint16_t index;        /* caller's index, e.g. into the wall array */
+} GridItem;
+
+typedef struct grid {
+	int cols;
+	int rows;
+	int cellShift;
+
+	GridItem items[GRID_MAX_ITEMS];
+	int numItems;
+
+	uint16_t cellStart[GRID_MAX_CELLS + 1];
+	uint16_t refs[GRID_MAX_REFS];
+	int numRefs;
+
+	/* Query de-duplication: an item is reported once per query even
+	   when it spans several cells */
+	uint16_t seen[GRID_MAX_ITEMS];
+	uint16_t stamp;
+} Grid;
+
+/* Empty grid covering width x height pixels */
+void gridInit(Grid *g, int width, int height);
+
+/* Add an item; returns 0 when the grid is full */
+int gridAddBox(Grid *g, int kind, int index, int x, int y, int w, int h);
+int gridAddCircle(Grid *g, int kind, int index, int cx, int cy, int r);
+
+/* Bucket the items into cells. Returns 0 if GRID_MAX_REFS is too small,
+   in which case queries fall back to scanning every item. */
+int gridBuild(Grid *g);
+
+/* Items of the kinds in mask whose bounds overlap x0..x1, y0..y1.
+   Writes up to max item numbers (into g->items) and returns the count. */
+int gridQuery(Grid *g, int x0, int y0, int x1, int y1, int mask, uint16_t *out, int max);
+
+#endif
@@ -0,0 +1,118 @@
+#include "Level.h"
+
+static const uint8_t levelMagic[4] = { 'L', 'B', 'Y', 'L' };
+
+static int get16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static const uint8_t *getZone(const uint8_t *p, LevelZone *z)
+{
+	z->x = get16(p);
+	z->y = get16(p + 2);
+	z->radius = p[4];
+	z->color = get16(p + 5);
+	return p + LEVEL_HOLE_SIZE;
+}
+
+static void addDraw(Level *lv, int op, int x0, int y0, int x1, int y1, int r, int color)
+{
+	LevelDraw *d = &lv->draw[lv->numDraw++];
+	d->op = op;
+	d->x0 = x0;
+	d->y0 = y0;
+	d->x1 = x1;
+	d->y1 = y1;
+	d->r = r;
+	d->color = color;
+}
+
+int levelLoad(Level *lv, const uint8_t *data, int size, Grid *grid)
+{
+	const uint8_t *p;
+	int i, flags, ok = 1;
+
+	if (size < LEVEL_HEADER_SIZE) {
+		return LEVEL_ERR_FORMAT;
+	}
+	for (i = 0; i < 4; i++) {
+		if (data[i] != levelMagic[i]) {
+			return LEVEL_ERR_FORMAT;
+		}
+	}
+	if (data[4] != LEVEL_VERSION) {
+		return LEVEL_ERR_FORMAT;
+	}
+	flags = data[5];
+	lv->width = get16(data + 6);
+	lv->height = get16(data + 8);
+	lv->startX = get16(data + 10);
+	lv->startY = get16(data + 12);
+	lv->numWalls = data[14];
+	lv->numHoles = data[15];
+	lv->background = get16(data + 16);
+	lv->numRuns = (flags & LEVEL_FLAG_RUNS) ? get16(data + 18) : 0;
+	if (lv->numWalls > LEVEL_MAX_WALLS || lv->numHoles > LEVEL_MAX_HOLES) {
+		return LEVEL_ERR_SIZE;
+	}
+	if (size < LEVEL_HEADER_SIZE + lv->numWalls * LEVEL_WALL_SIZE
+	           + lv->numHoles * LEVEL_HOLE_SIZE + lv->numRuns * LEVEL_RUN_SIZE) {
+		return LEVEL_ERR_FORMAT;
+	}
+
+	/* Collision data and the draw list are built together, walking the
+	   data once. Without runs the level is painted shape by shape over
+	   a cleared background, in file order. */
+	lv->numDraw = 0;
+	if (lv->numRuns == 0) {
+		addDraw(lv, LEVEL_DRAW_RECT, 0, 0, lv->width - 1, lv->height - 1, 0, lv->background);
+	}
+	gridInit(grid, lv->width, lv->height);
+
+	getZone(data + 20, &lv->goal);
+	p = data + LEVEL_HEADER_SIZE;
+	for (i = 0; i < lv->numWalls; i++, p += LEVEL_WALL_SIZE) {
+		PhysBox *b = &lv->walls[i];
+		b->x = get16(p);
+		b->y = get16(p + 2);
+		b->w = get16(p + 4);
+		b->h = get16(p + 6);
+		lv->wallColor[i] = get16(p + 8);
+		ok &= gridAddBox(grid, GRID_WALL, i, b->x, b->y, b->w, b->h);
+		if (lv->numRuns == 0) {
+			addDraw(lv, LEVEL_DRAW_RECT, b->x, b->y, b->x + b->w, b->y + b->h, 0, lv->wallColor[i]);
+		}
+	}
+	for (i = 0; i < lv->numHoles; i++) {
+		LevelZone *z = &lv->holes[i];
+		p = getZone(p, z);
+		ok &= gridAddCircle(grid, GRID_HOLE, i, z->x, z->y, z->radius);
+		if (lv->numRuns == 0) {
+			addDraw(lv, LEVEL_DRAW_CIRCLE, z->x, z->y, 0, 0, z->radius, z->color);
+		}
+	}
+	ok &= gridAddCircle(grid, GRID_GOAL, 0, lv->goal.x, lv->goal.y, lv->goal.radius);
+	if (lv->numRuns == 0) {
+		addDraw(lv, LEVEL_DRAW_CIRCLE, lv->goal.x, lv->goal.y, 0, 0, lv->goal.radius, lv->goal.color);
+		lv->runs = 0;
+	} else {
+		addDraw(lv, LEVEL_DRAW_RUNS, 0, 0, lv->width - 1, lv->height - 1, 0, lv->background);
+		lv->runs = p;
+	}
+
+	if (!ok || !gridBuild(grid)) {
+		return LEVEL_ERR_GRID;
+	}
+	return LEVEL_OK;
+}
+
+int levelRunCount(const Level *lv, int i)
+{
+	return get16(lv->runs + i * LEVEL_RUN_SIZE);
+}
+
+uint16_t levelRunColor(const Level *lv, int i)
+{
+	return get16(lv->runs + i * LEVEL_RUN_SIZE + 2);
+}
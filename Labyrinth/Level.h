@@ -0,0 +1,106 @@
+/* Labyrinth level format
+ *
+ * A level is a byte string, normally compiled from a text description
+ * by tools/levelc and linked in as a const array, but it can come from
+ * anywhere (SD card, serial) since nothing in it is code. All fields are
+ * little-endian and byte aligned:
+ *
+ *   0  'L' 'B' 'Y' 'L'
+ *   4  u8  version (LEVEL_VERSION)
+ *   5  u8  flags (LEVEL_FLAG_*)
+ *   6  u16 width, u16 height        pixels
+ *  10  u16 startX, u16 startY       marble start, pixels
+ *  14  u8  numWalls, u8 numHoles
+ *  16  u16 background colour        RGB565
+ *  18  u16 numRuns
+ *  20  goal:  u16 x, u16 y, u8 radius, u16 colour
+ *  27  walls: u16 x, u16 y, u16 w, u16 h, u16 colour   (10 bytes each)
+ *      holes: u16 x, u16 y, u8 radius, u16 colour     (7 bytes each)
+ *      runs:  u16 count, u16 colour                   (4 bytes each)
+ *
+ * Walls cover x..x+w, y..y+h inclusive as drawn. The optional runs are
+ * the whole background pre-rendered row by row (runs may wrap rows), so
+ * the level can be painted in one pass instead of shape by shape.
+ */
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <stdint.h>
+#include "Grid.h"
+#include "Physics.h"
+
+#define LEVEL_VERSION       1
+#define LEVEL_HEADER_SIZE   27
+#define LEVEL_WALL_SIZE     10
+#define LEVEL_HOLE_SIZE     7
+#define LEVEL_RUN_SIZE      4
+
+#define LEVEL_MAX_WALLS     255   /* numWalls is a byte */
+#define LEVEL_MAX_HOLES     64
+#define LEVEL_MAX_RUNS      65535 /* numRuns is a u16 */
+#define LEVEL_MAX_DRAW      (LEVEL_MAX_WALLS + LEVEL_MAX_HOLES + 2)
+
+#define LEVEL_FLAG_RUNS     1     /* pre-rendered background follows */
+
+/* levelLoad() results */
+#define LEVEL_OK            0
+#define LEVEL_ERR_FORMAT    -1    /* bad magic, version or truncated */
+#define LEVEL_ERR_SIZE      -2    /* more walls or holes than fit */
+#define LEVEL_ERR_GRID      -3    /* the grid ran out of room */
+
+/* Draw list operations */
+#define LEVEL_DRAW_RECT     1     /* fillrect(x0, y0, x1, y1) */
+#define LEVEL_DRAW_CIRCLE   2     /* fillcircle(x0, y0, r) */
+#define LEVEL_DRAW_RUNS     3     /* the pre-rendered runs, whole level */
+
+typedef struct levelZone {
+	int16_t x;             /* centre */
+	int16_t y;
+	uint8_t radius;
+	uint16_t color;
+} LevelZone;
+
+typedef struct levelDraw {
+	uint8_t op;
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;            /* LEVEL_DRAW_RECT */
+	int16_t y1;
+	int16_t r;             /* LEVEL_DRAW_CIRCLE */
+	uint16_t color;
+} LevelDraw;
+
+typedef struct level {
+	int width;
+	int height;
+	int startX;
+	int startY;
+	uint16_t background;
+
+	PhysBox walls[LEVEL_MAX_WALLS];
+	uint16_t wallColor[LEVEL_MAX_WALLS];
+	int numWalls;
+	LevelZone holes[LEVEL_MAX_HOLES];
+	int numHoles;
+	LevelZone goal;
+
+	/* Pre-rendered background, pointing into the level data */
+	const uint8_t *runs;
+	int numRuns;
+
+	/* What to paint, in order, to show the level */
+	LevelDraw draw[LEVEL_MAX_DRAW];
+	int numDraw;
+} Level;
+
+/* Parse size bytes of level data. Fills lv, and the grid with the walls
+   (GRID_WALL, wall number), holes (GRID_HOLE, hole number) and goal
+   (GRID_GOAL, 0), then builds it. The data must outlive lv when it has
+   runs. Returns LEVEL_OK or a LEVEL_ERR_* code. */
+int levelLoad(Level *lv, const uint8_t *data, int size, Grid *grid);
+
+/* Length in pixels and colour of run i */
+int levelRunCount(const Level *lv, int i);
+uint16_t levelRunColor(const Level *lv, int i);
+
+#endif
@@ -0,0 +1,424 @@
+/* Generated by tools/levelc from Labyrinth/levels/level1.txt - do not edit */
+#include "Levels.h"
+
+/* 12 walls, 13 holes, 1607 runs */
+const unsigned char level1[] = {
+	0x4C, 0x42, 0x59, 0x4C, 0x01, 0x01, 0x40, 0x01, 0xF0, 0x00, 0x13, 0x00, 0x13, 0x00, 0x0C, 0x0D,
+	0x00, 0x00, 0x47, 0x06, 0x22, 0x01, 0x7D, 0x00, 0x0A, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0x01, 0x08, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x00, 0x78, 0x00,
+	0x00, 0xE8, 0x00, 0x40, 0x01, 0x08, 0x00, 0x00, 0x78, 0x38, 0x01, 0x00, 0x00, 0x08, 0x00, 0xF0,
+	0x00, 0x00, 0x78, 0x00, 0x00, 0x32, 0x00, 0xE6, 0x00, 0x08, 0x00, 0x00, 0x78, 0xD6, 0x00, 0x64,
+	0x00, 0x6A, 0x00, 0x08, 0x00, 0x00, 0x78, 0x32, 0x00, 0x96, 0x00, 0xA4, 0x00, 0x08, 0x00, 0x00,
+	0x78, 0x32, 0x00, 0x64, 0x00, 0x08, 0x00, 0x64, 0x00, 0x00, 0x78, 0x96, 0x00, 0x32, 0x00, 0x08,
+	0x00, 0x3A, 0x00, 0x00, 0x78, 0x6A, 0x00, 0xB9, 0x00, 0x08, 0x00, 0x82, 0x00, 0x00, 0x78, 0xD6,
+	0x00, 0x64, 0x00, 0x08, 0x00, 0x69, 0x00, 0x00, 0x78, 0x06, 0x01, 0x8F, 0x00, 0x62, 0x00, 0x08,
+	0x00, 0x00, 0x78, 0x22, 0x01, 0x1C, 0x00, 0x0A, 0xEF, 0x7B, 0x18, 0x00, 0x49, 0x00, 0x0A, 0xEF,
+	0x7B, 0xF3, 0x00, 0xAF, 0x00, 0x0A, 0xEF, 0x7B, 0x64, 0x00, 0x64, 0x00, 0x0A, 0xEF, 0x7B, 0x27,
+	0x01, 0xD7, 0x00, 0x0A, 0xEF, 0x7B, 0x3C, 0x00, 0x23, 0x00, 0x0A, 0xEF, 0x7B, 0x7D, 0x00, 0x19,
+	0x00, 0x0A, 0xEF, 0x7B, 0xD6, 0x00, 0x23, 0x00, 0x0A, 0xEF, 0x7B, 0xB6, 0x00, 0x82, 0x00, 0x0A,
+	0xEF, 0x7B, 0x18, 0x00, 0xD8, 0x00, 0x0A, 0xEF, 0x7B, 0x9D, 0x00, 0xB4, 0x00, 0x0A, 0xEF, 0x7B,
+	0x04, 0x01, 0x4B, 0x00, 0x0A, 0xEF, 0x7B, 0x23, 0x00, 0x90, 0x00, 0x0A, 0xEF, 0x7B, 0x49, 0x0B,
+	0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0xB7, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0xB5, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0xB4, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x9A, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x6C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x97, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x95, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x94, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x92, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x6A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x91, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x6A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x91, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x33, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x4B, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x3E, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x31, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x49, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x3C, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x46, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x38, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x38, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x38, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x38, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x31, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x49, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x39, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x4B, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x85, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x85, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3C, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x85, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3E, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x87, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x58, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2A, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x87, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x58, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2B, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x89, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x8B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x5A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x8D, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x5B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2E, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x8F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x5C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x93, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x5E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x2F, 0x01, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00,
+	0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00,
+	0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00,
+	0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00,
+	0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x7A, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x78, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x77, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x62, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x76, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x60, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x75, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x2D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x74, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x2C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x74, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5D, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x2B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5C, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5C, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x74, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x74, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x75, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5C, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x76, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5C, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x77, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5D, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x2B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x78, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x2C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x7A, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5F, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x2D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x60, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x62, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x8D, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x56, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x2C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x55, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x2B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x54, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x53, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x52, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x52, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x51, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x99, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x21, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x22, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x2A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x23, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x2B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x37, 0x00, 0x00, 0x00, 0x73, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x24, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x6C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x6E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xE0, 0x07, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xE0, 0x07, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xE0, 0x07, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00, 0xE0, 0x07, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x78, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x3A, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xE0, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x76, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x1A, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3A, 0x00, 0x00, 0x00, 0x13, 0x00, 0xE0, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x75, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x74, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x73, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xE0, 0x07, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3A, 0x00, 0x00, 0x00, 0x13, 0x00, 0xE0, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x3A, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xE0, 0x07, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00, 0xE0, 0x07, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xE0, 0x07, 0x0E, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x71, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x15, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xE0, 0x07, 0x0F, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xE0, 0x07, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x15, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x72, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x40, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x73, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x17, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x74, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x18, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x75, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x76, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x1A, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x78, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x1C, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x04, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00,
+	0x00, 0x78, 0x13, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0xAD, 0x00,
+	0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x78, 0x14, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x08, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x15, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x09, 0x00, 0x00, 0x00, 0xAD, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x17, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x41, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x3E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x3D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x9B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x3C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x5F, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x35, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5D, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x33, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x5C, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x5B, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x5A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x3A, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0B, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x3B, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x3C, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00,
+	0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0D, 0x00, 0x00, 0x00, 0x0F, 0x00,
+	0xEF, 0x7B, 0x3D, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x58, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x2E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x0E, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x3E, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x00, 0x0B, 0x00,
+	0xEF, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x21, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0xEF, 0x7B, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x11, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x41, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x22, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0xEF, 0x7B, 0x30, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x23, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x24, 0x00, 0x00, 0x00, 0x0D, 0x00,
+	0xEF, 0x7B, 0x32, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x25, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x33, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0xEF, 0x7B, 0x35, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x2F, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x59, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x78, 0x63, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0x45, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x4E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x4C, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAE, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x4B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x4A, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAC, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x49, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAB, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAB, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAA, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x06, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0xEF, 0x7B, 0x47, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAB, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAB, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x13, 0x00, 0xEF, 0x7B, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAC, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x07, 0x00, 0x00, 0x00, 0x11, 0x00, 0xEF, 0x7B, 0x49, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAD, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x09, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xEF, 0x7B, 0x4A, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAE, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x0A, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x09, 0x00, 0x00, 0x00, 0x0D, 0x00, 0xEF, 0x7B, 0x4B, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x0B, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0A, 0x00, 0x00, 0x00, 0x0B, 0x00, 0xEF, 0x7B, 0x4C, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xB1, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x0D, 0x00, 0x00, 0x00, 0x11, 0x00,
+	0x00, 0x78, 0x0C, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEF, 0x7B, 0x4E, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x78, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00,
+	0x00, 0x78, 0xC5, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x00, 0x78,
+};
+const unsigned int level1Size = sizeof(level1);
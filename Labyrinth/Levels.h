@@ -0,0 +1,12 @@
+/* Labyrinth built-in levels
+ *
+ * Each is compiled from Labyrinth/levels/<name>.txt by tools/levelc and
+ * read with levelLoad().
+ */
+#ifndef LEVELS_H
+#define LEVELS_H
+
+extern const unsigned char level1[];
+extern const unsigned int level1Size;
+
+#endif
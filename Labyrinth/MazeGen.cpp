@@ -0,0 +1,419 @@
+#include "MazeGen.h"
+#include "Level.h"
+
+#define MAZE_UNREACHED  0xFFFF
+
+static uint32_t nextRandom(MazeGen *g)
+{
+	/* xorshift32 */
+	uint32_t x = g->rng;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	g->rng = x;
+	return x;
+}
+
+static int randomBelow(MazeGen *g, int n)
+{
+	return (int)(nextRandom(g) % (uint32_t)n);
+}
+
+static void shuffle(MazeGen *g, uint16_t *a, int n)
+{
+	for (int i = n - 1; i > 0; i--) {
+		int j = randomBelow(g, i + 1);
+		uint16_t t = a[i];
+		a[i] = a[j];
+		a[j] = t;
+	}
+}
+
+/* Remove the wall between two neighbouring cells */
+static void openBetween(MazeGen *g, int a, int b)
+{
+	if (b == a + 1) {
+		g->cell[a] |= MAZE_OPEN_E;
+	} else if (a == b + 1) {
+		g->cell[b] |= MAZE_OPEN_E;
+	} else if (b == a + g->cols) {
+		g->cell[a] |= MAZE_OPEN_S;
+	} else {
+		g->cell[b] |= MAZE_OPEN_S;
+	}
+}
+
+/* Neighbours of c, all of them or only those it has an opening to.
+   Writes up to 4 cells to out and returns how many. */
+static int neighbours(const MazeGen *g, int c, int openOnly, int *out)
+{
+	int col = c % g->cols;
+	int row = c / g->cols;
+	int n = 0;
+
+	if (col > 0 && (!openOnly || (g->cell[c - 1] & MAZE_OPEN_E))) {
+		out[n++] = c - 1;
+	}
+	if (col < g->cols - 1 && (!openOnly || (g->cell[c] & MAZE_OPEN_E))) {
+		out[n++] = c + 1;
+	}
+	if (row > 0 && (!openOnly || (g->cell[c - g->cols] & MAZE_OPEN_S))) {
+		out[n++] = c - g->cols;
+	}
+	if (row < g->rows - 1 && (!openOnly || (g->cell[c] & MAZE_OPEN_S))) {
+		out[n++] = c + g->cols;
+	}
+	return n;
+}
+
+/* Depth first: walk to a random unvisited neighbour, back up when
+   there is none. The queue is the stack. */
+static void carveBacktracker(MazeGen *g)
+{
+	int sp = 0;
+	int next[4];
+
+	g->cell[0] |= MAZE_VISITED;
+	g->queue[sp++] = 0;
+	while (sp > 0) {
+		int c = g->queue[sp - 1];
+		int all = neighbours(g, c, 0, next);
+		int n = 0;
+		for (int i = 0; i < all; i++) {
+			if (!(g->cell[next[i]] & MAZE_VISITED)) {
+				next[n++] = next[i];
+			}
+		}
+		if (n == 0) {
+			sp--;
+			continue;
+		}
+		int to = next[randomBelow(g, n)];
+		openBetween(g, c, to);
+		g->cell[to] |= MAZE_VISITED;
+		g->queue[sp++] = to;
+	}
+}
+
+static int findRoot(MazeGen *g, int c)
+{
+	while (g->link[c] != c) {
+		g->link[c] = g->link[g->link[c]];   /* path halving */
+		c = g->link[c];
+	}
+	return c;
+}
+
+/* Open the walls in random order, skipping any that would join two
+   cells that are already connected. An edge is cell * 2 + (0 east,
+   1 south). */
+static void carveKruskal(MazeGen *g)
+{
+	int cells = g->cols * g->rows;
+	int n = 0;
+
+	for (int c = 0; c < cells; c++) {
+		g->link[c] = c;
+		if (c % g->cols < g->cols - 1) {
+			g->edges[n++] = c * 2;
+		}
+		if (c / g->cols < g->rows - 1) {
+			g->edges[n++] = c * 2 + 1;
+		}
+	}
+	shuffle(g, g->edges, n);
+	for (int i = 0; i < n; i++) {
+		int a = g->edges[i] >> 1;
+		int b = (g->edges[i] & 1) ? a + g->cols : a + 1;
+		int ra = findRoot(g, a);
+		int rb = findRoot(g, b);
+		if (ra != rb) {
+			g->link[ra] = rb;
+			openBetween(g, a, b);
+		}
+	}
+}
+
+/* BFS from the first n cells of the queue, which start at distance 0.
+   Cells with holes are not entered. */
+static void bfs(MazeGen *g, int n)
+{
+	int cells = g->cols * g->rows;
+	int head = 0, tail = n;
+	int next[4];
+
+	for (int c = 0; c < cells; c++) {
+		g->dist[c] = MAZE_UNREACHED;
+	}
+	for (int i = 0; i < n; i++) {
+		g->dist[g->queue[i]] = 0;
+		g->link[g->queue[i]] = g->queue[i];
+	}
+	while (head < tail) {
+		int c = g->queue[head++];
+		int k = neighbours(g, c, 1, next);
+		for (int i = 0; i < k; i++) {
+			int to = next[i];
+			if (g->dist[to] == MAZE_UNREACHED && !g->hole[to]) {
+				g->dist[to] = g->dist[c] + 1;
+				g->link[to] = c;
+				g->queue[tail++] = to;
+			}
+		}
+	}
+}
+
+int mazeSolve(MazeGen *g, int start, int goal)
+{
+	g->queue[0] = start;
+	bfs(g, 1);
+	if (g->dist[goal] == MAZE_UNREACHED) {
+		return 0;
+	}
+	return g->dist[goal] + 1;
+}
+
+static uint8_t *put16(uint8_t *p, int v)
+{
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+	return p + 2;
+}
+
+static uint8_t *putZone(uint8_t *p, int x, int y, int r, int color)
+{
+	p = put16(p, x);
+	p = put16(p, y);
+	*p++ = r;
+	return put16(p, color);
+}
+
+/* Level writer state */
+typedef struct mazeOut {
+	uint8_t *p;
+	uint8_t *end;
+	int walls;
+	int width;
+	int height;
+	uint16_t color;
+} MazeOut;
+
+/* Append a wall covering x0..x1, y0..y1, clipped to the arena */
+static int putWall(MazeOut *o, int x0, int y0, int x1, int y1)
+{
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 > o->width - 1) x1 = o->width - 1;
+	if (y1 > o->height - 1) y1 = o->height - 1;
+	if (o->walls == LEVEL_MAX_WALLS || o->end - o->p < LEVEL_WALL_SIZE) {
+		return 0;
+	}
+	o->p = put16(o->p, x0);
+	o->p = put16(o->p, y0);
+	o->p = put16(o->p, x1 - x0);
+	o->p = put16(o->p, y1 - y0);
+	o->p = put16(o->p, o->color);
+	o->walls++;
+	return 1;
+}
+
+/* Merge each line of closed cell edges into one box; walls overlap by
+   half their thickness at the ends so that the corners are filled */
+static int putWalls(MazeGen *g, const MazeGenParams *prm, MazeOut *o)
+{
+	int cw = prm->width / g->cols;
+	int ch = prm->height / g->rows;
+	int t = prm->wallThickness;
+	int h = t / 2;
+	int ok = 1;
+
+	/* frame, half thickness since there is no cell beyond it */
+	ok &= putWall(o, 0, 0, prm->width - 1, h - 1);
+	ok &= putWall(o, 0, 0, h - 1, prm->height - 1);
+	ok &= putWall(o, 0, g->rows * ch - h, prm->width - 1, prm->height - 1);
+	ok &= putWall(o, g->cols * cw - h, 0, prm->width - 1, prm->height - 1);
+
+	for (int r = 0; r < g->rows - 1 && ok; r++) {
+		int y = (r + 1) * ch - h;
+		for (int c = 0; c < g->cols; c++) {
+			if (g->cell[r * g->cols + c] & MAZE_OPEN_S) {
+				continue;
+			}
+			int c0 = c;
+			while (c + 1 < g->cols && !(g->cell[r * g->cols + c + 1] & MAZE_OPEN_S)) {
+				c++;
+			}
+			ok &= putWall(o, c0 * cw - h, y, (c + 1) * cw + h - 1, y + t - 1);
+		}
+	}
+	for (int c = 0; c < g->cols - 1 && ok; c++) {
+		int x = (c + 1) * cw - h;
+		for (int r = 0; r < g->rows; r++) {
+			if (g->cell[r * g->cols + c] & MAZE_OPEN_E) {
+				continue;
+			}
+			int r0 = r;
+			while (r + 1 < g->rows && !(g->cell[(r + 1) * g->cols + c] & MAZE_OPEN_E)) {
+				r++;
+			}
+			ok &= putWall(o, x, r0 * ch - h, x + t - 1, (r + 1) * ch + h - 1);
+		}
+	}
+	return ok;
+}
+
+/* Holes go in the cells nearest the route without being on it: first
+   all the cells beside it, in random order, then those one further out
+   and so on. dist[] must hold the distance to the route. Never next to
+   the start, where the marble sits before the player has tilted. */
+static int placeHoles(MazeGen *g, int numHoles, int goal, int *beside)
+{
+	int cells = g->cols * g->rows;
+	int placed = 0;
+
+	*beside = 0;
+	for (int d = 1; placed < numHoles; d++) {
+		int n = 0;
+		for (int c = 0; c < cells; c++) {
+			if (g->dist[c] == d && c != goal && c != 1 && c != g->cols) {
+				g->queue[n++] = c;
+			}
+		}
+		if (n == 0) {
+			/* also covers a distance beyond the furthest cell */
+			int further = 0;
+			for (int c = 0; c < cells; c++) {
+				if (g->dist[c] != MAZE_UNREACHED && g->dist[c] > d) {
+					further = 1;
+				}
+			}
+			if (!further) {
+				break;
+			}
+			continue;
+		}
+		shuffle(g, g->queue, n);
+		for (int i = 0; i < n && placed < numHoles; i++) {
+			g->hole[g->queue[i]] = 1;
+			placed++;
+			if (d == 1) {
+				(*beside)++;
+			}
+		}
+	}
+	return placed;
+}
+
+int mazeGenerate(MazeGen *g, const MazeGenParams *p, uint8_t *out, int max, MazeGenStats *stats)
+{
+	int cells = p->cols * p->rows;
+	int goal = 0;
+	int next[4];
+	MazeGenStats s;
+	MazeOut o;
+
+	if (p->cols < 2 || p->rows < 2 || p->cols > MAZE_GEN_MAX_COLS || p->rows > MAZE_GEN_MAX_ROWS
+	        || p->numHoles < 0 || p->numHoles > LEVEL_MAX_HOLES || p->seed == 0 || max < LEVEL_HEADER_SIZE) {
+		return 0;
+	}
+	g->cols = p->cols;
+	g->rows = p->rows;
+	g->rng = p->seed;
+	for (int c = 0; c < cells; c++) {
+		g->cell[c] = 0;
+		g->hole[c] = 0;
+	}
+
+	if (p->algorithm == MAZE_KRUSKAL) {
+		carveKruskal(g);
+	} else {
+		carveBacktracker(g);
+	}
+
+	/* goal in the cell furthest from the start (top left) */
+	mazeSolve(g, 0, 0);
+	for (int c = 0; c < cells; c++) {
+		if (g->dist[c] > g->dist[goal]) {
+			goal = c;
+		}
+	}
+	s.pathCells = g->dist[goal] + 1;
+
+	/* mark the route and count its turns */
+	s.turns = 0;
+	int step = 0;
+	for (int c = goal; ; c = g->link[c]) {
+		g->cell[c] |= MAZE_ON_PATH;
+		if (c == 0) {
+			break;
+		}
+		int dir = g->link[c] - c;
+		if (step != 0 && dir != step) {
+			s.turns++;
+		}
+		step = dir;
+	}
+	s.deadEnds = 0;
+	for (int c = 0; c < cells; c++) {
+		if (neighbours(g, c, 1, next) == 1) {
+			s.deadEnds++;
+		}
+	}
+
+	/* distance of every cell from the route */
+	int n = 0;
+	for (int c = 0; c < cells; c++) {
+		if (g->cell[c] & MAZE_ON_PATH) {
+			g->queue[n++] = c;
+		}
+	}
+	bfs(g, n);
+	s.holes = placeHoles(g, p->numHoles, goal, &s.holesBeside);
+	s.difficulty = s.pathCells + 2 * s.turns + 4 * s.holesBeside;
+
+	/* holes are only ever off the route, but check */
+	if (mazeSolve(g, 0, goal) == 0) {
+		return 0;
+	}
+
+	/* header, with the counts filled in at the end */
+	int cw = p->width / g->cols;
+	int ch = p->height / g->rows;
+	o.p = out;
+	o.end = out + max;
+	*o.p++ = 'L';
+	*o.p++ = 'B';
+	*o.p++ = 'Y';
+	*o.p++ = 'L';
+	*o.p++ = LEVEL_VERSION;
+	*o.p++ = 0;
+	o.p = put16(o.p, p->width);
+	o.p = put16(o.p, p->height);
+	o.p = put16(o.p, cw / 2);
+	o.p = put16(o.p, ch / 2);
+	o.p += 2;
+	o.p = put16(o.p, p->background);
+	o.p = put16(o.p, 0);
+	o.p = putZone(o.p, (goal % g->cols) * cw + cw / 2, (goal / g->cols) * ch + ch / 2, p->goalRadius, p->goalColor);
+	o.walls = 0;
+	o.width = p->width;
+	o.height = p->height;
+	o.color = p->wallColor;
+	if (!putWalls(g, p, &o) || o.end - o.p < s.holes * LEVEL_HOLE_SIZE) {
+		return 0;
+	}
+	for (int c = 0; c < cells; c++) {
+		if (g->hole[c]) {
+			o.p = putZone(o.p, (c % g->cols) * cw + cw / 2, (c / g->cols) * ch + ch / 2, p->holeRadius, p->holeColor);
+		}
+	}
+	out[14] = o.walls;
+	out[15] = s.holes;
+
+	s.walls = o.walls;
+	s.bytes = o.p - out;
+	if (stats != 0) {
+		*stats = s;
+	}
+	return s.bytes;
+}
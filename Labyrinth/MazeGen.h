@@ -0,0 +1,94 @@
+/* Labyrinth maze generator
+ *
+ * Carves a perfect maze (exactly one route between any two cells) on a
+ * grid of cells, either with a recursive backtracker (long winding
+ * corridors) or Kruskal's algorithm (many short dead ends), then puts
+ * the goal in the cell furthest from the start and holes in the cells
+ * just off the solution path, where a marble that misses a turn ends
+ * up. A BFS over the cells with the holes blocked checks that the goal
+ * can still be reached.
+ *
+ * The result is written in the binary level format (Level.h), so the
+ * game loads it exactly like a compiled level. All working memory is in
+ * the MazeGen struct, sized for MAZE_GEN_MAX_CELLS; nothing is
+ * allocated. The random generator is a seeded xorshift, so a seed
+ * always gives the same maze.
+ */
+#ifndef MAZEGEN_H
+#define MAZEGEN_H
+
+#include <stdint.h>
+
+#define MAZE_GEN_MAX_COLS     32
+#define MAZE_GEN_MAX_ROWS     24
+#define MAZE_GEN_MAX_CELLS    (MAZE_GEN_MAX_COLS * MAZE_GEN_MAX_ROWS)
+
+/* Cell bits */
+#define MAZE_OPEN_E           1
+#define MAZE_OPEN_S           2
+#define MAZE_VISITED          4     /* generation only */
+#define MAZE_ON_PATH          8     /* on the route from start to goal */
+
+#define MAZE_BACKTRACKER      0
+#define MAZE_KRUSKAL          1
+
+typedef struct mazeGenParams {
+	int algorithm;         /* MAZE_BACKTRACKER or MAZE_KRUSKAL */
+	uint32_t seed;         /* any value but 0 */
+	int cols;              /* cells */
+	int rows;
+	int width;             /* arena, pixels; cells are width/cols wide */
+	int height;
+	int wallThickness;     /* pixels */
+	int holeRadius;
+	int goalRadius;
+	int numHoles;          /* at most (LEVEL_MAX_HOLES); fewer if the maze has no room */
+	uint16_t background;
+	uint16_t wallColor;
+	uint16_t holeColor;
+	uint16_t goalColor;
+} MazeGenParams;
+
+typedef struct mazeGenStats {
+	int pathCells;         /* cells on the route from start to goal */
+	int turns;             /* changes of direction along it */
+	int deadEnds;          /* cells with one opening */
+	int holes;             /* holes placed */
+	int holesBeside;       /* holes in a cell next to the route */
+	int walls;             /* wall boxes after merging */
+	int difficulty;        /* pathCells + 2*turns + 4*holesBeside */
+	int bytes;             /* level size */
+} MazeGenStats;
+
+typedef struct mazeGen {
+	int cols;
+	int rows;
+	uint32_t rng;
+
+	/* Per cell: MAZE_OPEN_* bits for the openings east and south */
+	uint8_t cell[MAZE_GEN_MAX_CELLS];
+	/* Per cell: 1 if it has a hole */
+	uint8_t hole[MAZE_GEN_MAX_CELLS];
+
+	/* Scratch, shared between the steps: the backtracker stack and the
+	   BFS queue, the union-find parents and the BFS predecessors,
+	   BFS distances, and Kruskal's edge list */
+	uint16_t queue[MAZE_GEN_MAX_CELLS];
+	uint16_t link[MAZE_GEN_MAX_CELLS];
+	uint16_t dist[MAZE_GEN_MAX_CELLS];
+	uint16_t edges[2 * MAZE_GEN_MAX_CELLS];
+} MazeGen;
+
+/* Generate a maze and write it as a level into out (max bytes).
+   Returns the level size, or 0 if the parameters are out of range, the
+   level does not fit in max, or it has more walls than Level.h allows.
+   stats may be NULL. */
+int mazeGenerate(MazeGen *g, const MazeGenParams *p, uint8_t *out, int max, MazeGenStats *stats);
+
+/* BFS from start to goal over the open cells, not entering any cell
+   marked in hole[]. Returns the number of cells on the shortest route,
+   or 0 if the goal cannot be reached. Leaves the distances in dist[]
+   and each cell's predecessor in link[]. */
+int mazeSolve(MazeGen *g, int start, int goal);
+
+#endif
@@ -0,0 +1,97 @@
+#include "Occupancy.h"
+
+void occInit(Occupancy *o, int width, int height)
+{
+	o->width = width < OCC_MAX_WIDTH ? width : OCC_MAX_WIDTH;
+	o->height = height < OCC_MAX_HEIGHT ? height : OCC_MAX_HEIGHT;
+	o->stride = (o->width + 31) >> 5;
+	for (int i = 0; i < o->stride * o->height; i++) {
+		o->bits[i] = 0;
+	}
+}
+
+/* Bits x0..x1 of a word, 0 <= x0 <= x1 <= 31 */
+static uint32_t wordMask(int x0, int x1)
+{
+	return (0xFFFFFFFFu << x0) & (0xFFFFFFFFu >> (31 - x1));
+}
+
+/* Clip a row span to the bitmap; 0 if nothing is left */
+static int clipSpan(const Occupancy *o, int y, int *x0, int *x1)
+{
+	if (y < 0 || y >= o->height) {
+		return 0;
+	}
+	if (*x0 < 0) {
+		*x0 = 0;
+	}
+	if (*x1 > o->width - 1) {
+		*x1 = o->width - 1;
+	}
+	return *x0 <= *x1;
+}
+
+static void fillSpan(Occupancy *o, int y, int x0, int x1)
+{
+	if (!clipSpan(o, y, &x0, &x1)) {
+		return;
+	}
+	uint32_t *row = &o->bits[y * o->stride];
+	int w0 = x0 >> 5, w1 = x1 >> 5;
+	if (w0 == w1) {
+		row[w0] |= wordMask(x0 & 31, x1 & 31);
+		return;
+	}
+	row[w0] |= wordMask(x0 & 31, 31);
+	for (int w = w0 + 1; w < w1; w++) {
+		row[w] = 0xFFFFFFFFu;
+	}
+	row[w1] |= wordMask(0, x1 & 31);
+}
+
+static int testSpan(const Occupancy *o, int y, int x0, int x1)
+{
+	if (!clipSpan(o, y, &x0, &x1)) {
+		return 0;
+	}
+	const uint32_t *row = &o->bits[y * o->stride];
+	int w0 = x0 >> 5, w1 = x1 >> 5;
+	if (w0 == w1) {
+		return (row[w0] & wordMask(x0 & 31, x1 & 31)) != 0;
+	}
+	if (row[w0] & wordMask(x0 & 31, 31)) {
+		return 1;
+	}
+	for (int w = w0 + 1; w < w1; w++) {
+		if (row[w]) {
+			return 1;
+		}
+	}
+	return (row[w1] & wordMask(0, x1 & 31)) != 0;
+}
+
+void occFillRect(Occupancy *o, int x0, int y0, int x1, int y1)
+{
+	for (int y = y0; y <= y1; y++) {
+		fillSpan(o, y, x0, x1);
+	}
+}
+
+/* The disc as one span per row: the half-width shrinks as the row moves
+   away from the centre, so it is stepped down rather than square-rooted */
+int occTestDisc(const Occupancy *o, int cx, int cy, int r)
+{
+	int half = r;
+	for (int dy = 0; dy <= r; dy++) {
+		while (half * half + dy * dy > r * r) {
+			half--;
+		}
+		if (testSpan(o, cy - dy, cx - half, cx + half)) {
+			return 1;
+		}
+		if (dy && testSpan(o, cy + dy, cx - half, cx + half)) {
+			return 1;
+		}
+	}
+	return 0;
+}
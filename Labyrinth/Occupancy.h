@@ -0,0 +1,37 @@
+/* Labyrinth occupancy bitmap
+ *
+ * One bit per pixel, set where the level is solid, rasterized from its
+ * walls once per level. Whether anything solid lies under the marble
+ * is then a handful of 32-bit word tests per row instead of a test
+ * against every wall.
+ *
+ * Rows are packed into words, pixel x of a row in bit x & 31 of word
+ * x >> 5; 320x240 takes 9600 bytes. Everything outside the bitmap reads
+ * as empty (the screen edges are the physics' business).
+ */
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <stdint.h>
+
+#define OCC_MAX_WIDTH     320
+#define OCC_MAX_HEIGHT    240
+#define OCC_MAX_WORDS     ((OCC_MAX_WIDTH + 31) / 32 * OCC_MAX_HEIGHT)
+
+typedef struct occupancy {
+	int width;
+	int height;
+	int stride;            /* words per row */
+	uint32_t bits[OCC_MAX_WORDS];
+} Occupancy;
+
+/* Empty bitmap of width x height pixels, clipped to the maximum */
+void occInit(Occupancy *o, int width, int height);
+
+/* Mark x0..x1, y0..y1 inclusive solid */
+void occFillRect(Occupancy *o, int x0, int y0, int x1, int y1);
+
+/* Is any pixel within r of cx,cy (dx*dx + dy*dy <= r*r) solid? */
+int occTestDisc(const Occupancy *o, int cx, int cy, int r);
+
+#endif
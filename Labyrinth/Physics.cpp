@@ -0,0 +1,454 @@
+#include "Physics.h"
+
+#define PHYS_HALF          (PHYS_ONE / 2)
+#define PHYS_MAX_CONTACTS  32   /* walls near one sweep or contact */
+#define PHYS_MAX_SWEEPS    4    /* walls one step's move can slide off */
+#define PHYS_T_ONE         65536                /* time of impact: the whole move */
+#define PHYS_T_NEVER       ((int64_t)1 << 40)  /* an axis the move never leaves */
+#define PHYS_GRAZE         16   /* Q8 px/step into a corner below which it is only grazed */
+
+static int32_t clamp32(int32_t v, int32_t lo, int32_t hi)
+{
+	if (v < lo) {
+		return lo;
+	} else if (v > hi) {
+		return hi;
+	}
+	return v;
+}
+
+static int32_t isqrt64(int64_t v)
+{
+	int64_t r = 0;
+	int64_t bit = (int64_t)1 << 62;
+
+	while (bit > v) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (v >= r + bit) {
+			v -= r + bit;
+			r = (r >> 1) + bit;
+		} else {
+			r >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (int32_t)r;
+}
+
+/* Push the marble out of one wall and bounce it off the contact normal */
+static void collideBox(const Physics *p, Marble *m, const PhysBox *b)
+{
+	int32_t r = (int32_t)m->radius << PHYS_Q;
+	int32_t x0 = (int32_t)b->x << PHYS_Q;
+	int32_t y0 = (int32_t)b->y << PHYS_Q;
+	int32_t x1 = (int32_t)(b->x + b->w) << PHYS_Q;
+	int32_t y1 = (int32_t)(b->y + b->h) << PHYS_Q;
+	int32_t dx = m->x - clamp32(m->x, x0, x1);
+	int32_t dy = m->y - clamp32(m->y, y0, y1);
+	int64_t d2 = (int64_t)dx * dx + (int64_t)dy * dy;
+	int32_t nx, ny, vn;
+
+	if (d2 >= (int64_t)r * r) {
+		return;
+	}
+	if (d2 == 0) {
+		/* centre inside the box: leave through the nearest face */
+		int32_t left = m->x - x0, right = x1 - m->x;
+		int32_t top = m->y - y0, bottom = y1 - m->y;
+		int32_t least = left;
+		nx = -PHYS_ONE;
+		ny = 0;
+		if (right < least) {
+			least = right;
+			nx = PHYS_ONE;
+		}
+		if (top < least) {
+			least = top;
+			nx = 0;
+			ny = -PHYS_ONE;
+		}
+		if (bottom < least) {
+			least = bottom;
+			nx = 0;
+			ny = PHYS_ONE;
+		}
+		m->x += nx * (least + r) / PHYS_ONE;
+		m->y += ny * (least + r) / PHYS_ONE;
+	} else {
+		int32_t dist = isqrt64(d2);
+		nx = dx * PHYS_ONE / dist;
+		ny = dy * PHYS_ONE / dist;
+		m->x += nx * (r - dist) / PHYS_ONE;
+		m->y += ny * (r - dist) / PHYS_ONE;
+	}
+	vn = (m->vx * nx + m->vy * ny) / PHYS_ONE;
+	if (vn < 0) {
+		int32_t j = vn * (PHYS_ONE + p->restitution) / PHYS_ONE;
+		m->vx -= j * nx / PHYS_ONE;
+		m->vy -= j * ny / PHYS_ONE;
+	}
+}
+
+static void collideEdges(const Physics *p, Marble *m)
+{
+	int32_t r = (int32_t)m->radius << PHYS_Q;
+	int32_t maxX = ((int32_t)p->width << PHYS_Q) - r;
+	int32_t maxY = ((int32_t)p->height << PHYS_Q) - r;
+
+	if (m->x < r) {
+		m->x = r;
+		m->vx = -m->vx * p->restitution / PHYS_ONE;
+	} else if (m->x > maxX) {
+		m->x = maxX;
+		m->vx = -m->vx * p->restitution / PHYS_ONE;
+	}
+	if (m->y < r) {
+		m->y = r;
+		m->vy = -m->vy * p->restitution / PHYS_ONE;
+	} else if (m->y > maxY) {
+		m->y = maxY;
+		m->vy = -m->vy * p->restitution / PHYS_ONE;
+	}
+}
+
+void physicsInit(Physics *p, int width, int height)
+{
+	p->gravity = 40;          /* ~0.16 px/step^2 = 1600 px/s^2 at 1g */
+	p->friction = 253;        /* ~1% per step */
+	p->restitution = 96;      /* keeps ~40% of the speed into a wall */
+	p->maxSpeed = 4 * PHYS_ONE;
+	p->width = width;
+	p->height = height;
+	p->walls = 0;
+	p->numWalls = 0;
+	p->grid = 0;
+	p->ax = 0;
+	p->ay = 0;
+	p->pending = 0;
+}
+
+void physicsSetWalls(Physics *p, const PhysBox *walls, int numWalls)
+{
+	p->walls = walls;
+	p->numWalls = numWalls;
+	p->grid = 0;
+}
+
+void physicsSetGrid(Physics *p, Grid *grid)
+{
+	p->grid = grid;
+}
+
+void physicsSetTilt(Physics *p, int tiltX, int tiltY, int oneG)
+{
+	p->ax = tiltX * p->gravity / oneG;
+	p->ay = tiltY * p->gravity / oneG;
+}
+
+/* Indices of the walls whose boxes come within reach of x0..x1, y0..y1
+   (pixels), in wall order so that the result does not depend on the
+   grid's cell layout */
+static int findWalls(const Physics *p, int x0, int y0, int x1, int y1, uint16_t *out)
+{
+	int n = 0;
+
+	if (p->grid != 0) {
+		uint16_t items[PHYS_MAX_CONTACTS];
+		n = gridQuery(p->grid, x0, y0, x1, y1, GRID_WALL, items, PHYS_MAX_CONTACTS);
+		for (int i = 0; i < n; i++) {
+			uint16_t v = p->grid->items[items[i]].index;
+			int j = i;
+			for (; j > 0 && out[j - 1] > v; j--) {
+				out[j] = out[j - 1];
+			}
+			out[j] = v;
+		}
+	} else {
+		for (int i = 0; i < p->numWalls && n < PHYS_MAX_CONTACTS; i++) {
+			const PhysBox *b = &p->walls[i];
+			if (b->x <= x1 && b->x + b->w >= x0 && b->y <= y1 && b->y + b->h >= y0) {
+				out[n++] = i;
+			}
+		}
+	}
+	return n;
+}
+
+/* Time at which a circle of radius r, whose centre moves from (px,py)
+   by (dx,dy), first touches box b. Everything is Q8 but the time, which
+   is 0..PHYS_T_ONE over the move. Returns 0 if it does not touch within
+   the move, is moving away, or already overlaps the box (that is left
+   to collideBox()); otherwise sets the time and the contact normal.
+   A contact the move does not head into (a graze along a face or past
+   a corner, e.g. where two boxes meet flush) is no contact: it would
+   stop the marble without anything to slide off.
+
+   The circle touches the box when its centre enters the box grown by r
+   with rounded corners, so this is a ray test against the grown box,
+   redone against a corner circle when the entry point is in a corner. */
+static int sweepBox(int32_t px, int32_t py, int32_t dx, int32_t dy, int32_t r,
+                    const PhysBox *b, int32_t *toi, int32_t *nx, int32_t *ny)
+{
+	int32_t x0 = (int32_t)b->x << PHYS_Q;
+	int32_t y0 = (int32_t)b->y << PHYS_Q;
+	int32_t x1 = (int32_t)(b->x + b->w) << PHYS_Q;
+	int32_t y1 = (int32_t)(b->y + b->h) << PHYS_Q;
+	int64_t enterX, exitX, enterY, exitY, enter, exit;
+
+	/* slab entry and exit times along each axis */
+	if (dx > 0) {
+		enterX = (int64_t)(x0 - r - px) * PHYS_T_ONE / dx;
+		exitX = (int64_t)(x1 + r - px) * PHYS_T_ONE / dx;
+	} else if (dx < 0) {
+		enterX = (int64_t)(x1 + r - px) * PHYS_T_ONE / dx;
+		exitX = (int64_t)(x0 - r - px) * PHYS_T_ONE / dx;
+	} else if (px >= x0 - r && px <= x1 + r) {
+		enterX = -PHYS_T_NEVER;
+		exitX = PHYS_T_NEVER;
+	} else {
+		return 0;
+	}
+	if (dy > 0) {
+		enterY = (int64_t)(y0 - r - py) * PHYS_T_ONE / dy;
+		exitY = (int64_t)(y1 + r - py) * PHYS_T_ONE / dy;
+	} else if (dy < 0) {
+		enterY = (int64_t)(y1 + r - py) * PHYS_T_ONE / dy;
+		exitY = (int64_t)(y0 - r - py) * PHYS_T_ONE / dy;
+	} else if (py >= y0 - r && py <= y1 + r) {
+		enterY = -PHYS_T_NEVER;
+		exitY = PHYS_T_NEVER;
+	} else {
+		return 0;
+	}
+	enter = enterX > enterY ? enterX : enterY;
+	exit = exitX < exitY ? exitX : exitY;
+	if (enter > exit || exit < 0 || enter > PHYS_T_ONE) {
+		return 0;
+	}
+
+	int32_t t = enter > 0 ? (int32_t)enter : 0;
+	int32_t hx = px + (int32_t)((int64_t)dx * t / PHYS_T_ONE);
+	int32_t hy = py + (int32_t)((int64_t)dy * t / PHYS_T_ONE);
+	int inX = hx >= x0 && hx <= x1;
+	int inY = hy >= y0 && hy <= y1;
+
+	if (inX || inY) {
+		/* a face: the later slab entry is the one that was crossed */
+		if (enter < 0) {
+			return 0;
+		}
+		*toi = t;
+		if (enterX > enterY) {
+			*nx = dx > 0 ? -PHYS_ONE : PHYS_ONE;
+			*ny = 0;
+		} else {
+			*nx = 0;
+			*ny = dy > 0 ? -PHYS_ONE : PHYS_ONE;
+		}
+		return 1;
+	}
+
+	/* a corner: solve |p + t*d - c| = r for the first t */
+	int32_t cx = hx < x0 ? x0 : x1;
+	int32_t cy = hy < y0 ? y0 : y1;
+	int64_t ox = px - cx;
+	int64_t oy = py - cy;
+	int64_t a = (int64_t)dx * dx + (int64_t)dy * dy;
+	int64_t hb = ox * dx + oy * dy;                 /* half of b */
+	int64_t c = ox * ox + oy * oy - (int64_t)r * r;
+	if (c <= 0 || hb >= 0) {
+		/* overlapping already, or moving away */
+		return 0;
+	}
+	int64_t disc = hb * hb - a * c;
+	if (disc <= 0) {
+		/* misses the corner, or just touches it in passing */
+		return 0;
+	}
+	int64_t root = (-hb - isqrt64(disc)) * PHYS_T_ONE / a;
+	if (root < 0 || root > PHYS_T_ONE) {
+		return 0;
+	}
+	*toi = (int32_t)root;
+	hx = px + (int32_t)((int64_t)dx * root / PHYS_T_ONE) - cx;
+	hy = py + (int32_t)((int64_t)dy * root / PHYS_T_ONE) - cy;
+	int32_t dist = isqrt64((int64_t)hx * hx + (int64_t)hy * hy);
+	if (dist == 0) {
+		return 0;
+	}
+	*nx = hx * PHYS_ONE / dist;
+	*ny = hy * PHYS_ONE / dist;
+	/* the slide off a contact is rounded, so it can leave a hair of
+	   the move still going into the corner; that must not stop it */
+	if (((int64_t)dx * *nx + (int64_t)dy * *ny) / PHYS_ONE > -PHYS_GRAZE) {
+		return 0;
+	}
+	return 1;
+}
+
+/* Time at which the centre, moving from (px,py) by (dx,dy), reaches the
+   line r in from a screen edge, like sweepBox(). A centre already past
+   the line hits it at once. */
+static int sweepEdges(const Physics *p, int32_t px, int32_t py, int32_t dx, int32_t dy, int32_t r,
+                      int32_t *toi, int32_t *nx, int32_t *ny)
+{
+	int32_t maxX = ((int32_t)p->width << PHYS_Q) - r;
+	int32_t maxY = ((int32_t)p->height << PHYS_Q) - r;
+	int64_t first = PHYS_T_ONE + 1, t;
+
+	if (dx < 0 && px + dx < r) {
+		t = px > r ? (int64_t)(r - px) * PHYS_T_ONE / dx : 0;
+		if (t < first) {
+			first = t;
+			*nx = PHYS_ONE;
+			*ny = 0;
+		}
+	} else if (dx > 0 && px + dx > maxX) {
+		t = px < maxX ? (int64_t)(maxX - px) * PHYS_T_ONE / dx : 0;
+		if (t < first) {
+			first = t;
+			*nx = -PHYS_ONE;
+			*ny = 0;
+		}
+	}
+	if (dy < 0 && py + dy < r) {
+		t = py > r ? (int64_t)(r - py) * PHYS_T_ONE / dy : 0;
+		if (t < first) {
+			first = t;
+			*nx = 0;
+			*ny = PHYS_ONE;
+		}
+	} else if (dy > 0 && py + dy > maxY) {
+		t = py < maxY ? (int64_t)(maxY - py) * PHYS_T_ONE / dy : 0;
+		if (t < first) {
+			first = t;
+			*nx = 0;
+			*ny = -PHYS_ONE;
+		}
+	}
+	if (first > PHYS_T_ONE) {
+		return 0;
+	}
+	*toi = (int32_t)first;
+	return 1;
+}
+
+void physicsStep(Physics *p, Marble *m)
+{
+	uint16_t near[PHYS_MAX_CONTACTS];
+	int32_t r = (int32_t)m->radius << PHYS_Q;
+	int n;
+
+	/* division rather than a shift so that small velocities of either
+	   sign decay to zero instead of creeping at -1 */
+	m->vx = (m->vx + p->ax) * p->friction / PHYS_ONE;
+	m->vy = (m->vy + p->ay) * p->friction / PHYS_ONE;
+	m->vx = clamp32(m->vx, -p->maxSpeed, p->maxSpeed);
+	m->vy = clamp32(m->vy, -p->maxSpeed, p->maxSpeed);
+
+	/* Sweep the marble along its move and stop it at the first wall or
+	   screen edge it would touch. The velocity bounces off it and the
+	   rest of the move slides along it, so a fast marble can neither
+	   tunnel through a wall nor stick to one. The edges are swept too:
+	   clamping the marble back from past an edge afterwards could put
+	   it into a wall the move was never tested against. */
+	int32_t mx = m->vx;
+	int32_t my = m->vy;
+	for (int sweep = 0; sweep < PHYS_MAX_SWEEPS && (mx != 0 || my != 0); sweep++) {
+		int x0 = (m->x + (mx < 0 ? mx : 0) - r) >> PHYS_Q;
+		int y0 = (m->y + (my < 0 ? my : 0) - r) >> PHYS_Q;
+		int x1 = (m->x + (mx > 0 ? mx : 0) + r) >> PHYS_Q;
+		int y1 = (m->y + (my > 0 ? my : 0) + r) >> PHYS_Q;
+		int32_t first = PHYS_T_ONE + 1, nx = 0, ny = 0;
+		int32_t toi, hnx, hny;
+
+		if (sweepEdges(p, m->x, m->y, mx, my, r, &toi, &hnx, &hny)) {
+			first = toi;
+			nx = hnx;
+			ny = hny;
+		}
+
+		n = findWalls(p, x0 - 1, y0 - 1, x1 + 1, y1 + 1, near);
+		for (int i = 0; i < n; i++) {
+			if (sweepBox(m->x, m->y, mx, my, r, &p->walls[near[i]], &toi, &hnx, &hny) && toi < first) {
+				first = toi;
+				nx = hnx;
+				ny = hny;
+			}
+		}
+		if (first > PHYS_T_ONE) {
+			m->x += mx;
+			m->y += my;
+			break;
+		}
+
+		int32_t sx = (int32_t)((int64_t)mx * first / PHYS_T_ONE);
+		int32_t sy = (int32_t)((int64_t)my * first / PHYS_T_ONE);
+		m->x += sx;
+		m->y += sy;
+		mx -= sx;
+		my -= sy;
+
+		int32_t rn = (mx * nx + my * ny) / PHYS_ONE;
+		if (rn < 0) {
+			mx -= rn * nx / PHYS_ONE;
+			my -= rn * ny / PHYS_ONE;
+		}
+		int32_t vn = (m->vx * nx + m->vy * ny) / PHYS_ONE;
+		if (vn < 0) {
+			int32_t j = vn * (PHYS_ONE + p->restitution) / PHYS_ONE;
+			m->vx -= j * nx / PHYS_ONE;
+			m->vy -= j * ny / PHYS_ONE;
+		}
+	}
+
+	/* Rounding leaves the marble a fraction of a pixel into a wall now
+	   and then, and a level can start it overlapping one; push it out */
+	int x = m->x >> PHYS_Q;
+	int y = m->y >> PHYS_Q;
+	int reach = m->radius + 1;
+	n = findWalls(p, x - reach, y - reach, x + reach, y + reach, near);
+	for (int i = 0; i < n; i++) {
+		collideBox(p, m, &p->walls[near[i]]);
+	}
+	collideEdges(p, m);
+}
+
+int physicsAdvance(Physics *p, Marble *m, uint32_t elapsedUs)
+{
+	int steps = 0;
+
+	p->pending += elapsedUs;
+	while (p->pending >= PHYS_STEP_US) {
+		if (steps == PHYS_MAX_STEPS) {
+			/* drop the backlog rather than fast-forward the marble */
+			p->pending = 0;
+			break;
+		}
+		physicsStep(p, m);
+		p->pending -= PHYS_STEP_US;
+		steps++;
+	}
+	return steps;
+}
+
+void marbleInit(Marble *m, int x, int y, int radius)
+{
+	m->x = (int32_t)x << PHYS_Q;
+	m->y = (int32_t)y << PHYS_Q;
+	m->vx = 0;
+	m->vy = 0;
+	m->radius = radius;
+}
+
+int marbleX(const Marble *m)
+{
+	return (m->x + PHYS_HALF) >> PHYS_Q;
+}
+
+int marbleY(const Marble *m)
+{
+	return (m->y + PHYS_HALF) >> PHYS_Q;
+}
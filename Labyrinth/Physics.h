@@ -0,0 +1,95 @@
+/* Labyrinth marble physics
+ *
+ * The marble has a fixed-point position and velocity. Tilt accelerates
+ * it, rolling friction slows it down, and walls and the screen edge
+ * bounce it back with some loss. The simulation always advances in
+ * steps of PHYS_STEP_US whatever the frame rate, and uses integer math
+ * only, so a given tilt sequence gives the same path on the board and
+ * on a PC.
+ *
+ * Each step sweeps the marble along its move and stops it where it
+ * first touches a wall or a screen edge, then lets the rest of the move
+ * slide along it, so maxSpeed is not limited by the wall thickness: a
+ * step can be longer than a wall is thick without the marble tunnelling
+ * through, near the screen edges included.
+ *
+ * Positions are Q8 pixels, velocities Q8 pixels per step and
+ * accelerations Q8 pixels per step per step. Coefficients are Q8
+ * (256 = 1.0).
+ */
+#ifndef PHYSICS_H
+#define PHYSICS_H
+
+#include <stdint.h>
+#include "Grid.h"
+
+#define PHYS_Q            8
+#define PHYS_ONE          (1 << PHYS_Q)
+#define PHYS_STEP_US      10000   /* 100 Hz */
+#define PHYS_MAX_STEPS    10      /* catch-up limit after a stall (e.g. a screen clear) */
+
+/* Solid axis-aligned box, pixels, as drawn by createWall():
+   covers x..x+w and y..y+h */
+typedef struct physBox {
+	int x;
+	int y;
+	int w;
+	int h;
+} PhysBox;
+
+typedef struct marble {
+	int32_t x;         /* centre, Q8 pixels */
+	int32_t y;
+	int32_t vx;        /* Q8 pixels per step */
+	int32_t vy;
+	int radius;        /* pixels */
+} Marble;
+
+typedef struct physics {
+	/* Tuning */
+	int gravity;       /* acceleration at 1g of tilt, Q8 px/step^2 */
+	int friction;      /* velocity kept per step, Q8 */
+	int restitution;   /* normal velocity kept by a bounce, Q8 */
+	int maxSpeed;      /* per axis, Q8 px/step */
+
+	/* Arena, pixels */
+	int width;
+	int height;
+	const PhysBox *walls;
+	int numWalls;
+	Grid *grid;        /* optional index of the walls, see physicsSetGrid() */
+
+	/* Current acceleration, Q8 px/step^2 */
+	int ax;
+	int ay;
+	/* Time not yet simulated, us */
+	uint32_t pending;
+} Physics;
+
+void physicsInit(Physics *p, int width, int height);
+
+/* Walls stay owned by the caller and must outlive their use.
+   Clears any grid set before. */
+void physicsSetWalls(Physics *p, const PhysBox *walls, int numWalls);
+
+/* Only test the walls near the marble. The grid's GRID_WALL items must
+   have the wall array indices as their index. */
+void physicsSetGrid(Physics *p, Grid *grid);
+
+/* Tilt in accelerometer counts, oneG counts per g, screen axes */
+void physicsSetTilt(Physics *p, int tiltX, int tiltY, int oneG);
+
+/* Run as many whole steps as elapsedUs (plus what was left over last
+   time) covers, at most PHYS_MAX_STEPS. Returns the number of steps. */
+int physicsAdvance(Physics *p, Marble *m, uint32_t elapsedUs);
+
+/* One step */
+void physicsStep(Physics *p, Marble *m);
+
+void marbleInit(Marble *m, int x, int y, int radius);
+
+/* Position rounded to the pixel the marble is drawn at */
+int marbleX(const Marble *m);
+int marbleY(const Marble *m);
+
+#endif
@@ -0,0 +1,375 @@
+#include "Recorder.h"
+
+static void stateInit(RecState *s)
+{
+	s->accX = 0;
+	s->accY = 0;
+	s->touchX = 0;
+	s->touchY = 0;
+	s->touchTime = 0;
+}
+
+void recInit(Recorder *r, uint8_t *buf, int size)
+{
+	r->buf = buf;
+	r->size = size;
+	r->len = 0;
+	r->full = 0;
+	r->frameStart = 0;
+	r->frames = 0;
+	stateInit(&r->state);
+}
+
+static uint32_t zigzag(int v)
+{
+	return v < 0 ? ((uint32_t)(-(v + 1)) << 1) | 1 : (uint32_t)v << 1;
+}
+
+static int unzigzag(uint32_t v)
+{
+	return (v & 1) ? -(int)(v >> 1) - 1 : (int)(v >> 1);
+}
+
+/* 7 bits a byte, low first; returns the length */
+static int putVarint(uint8_t *out, uint32_t v)
+{
+	int n = 0;
+	while (v >= 0x80) {
+		out[n++] = (uint8_t)(v | 0x80);
+		v >>= 7;
+	}
+	out[n++] = (uint8_t)v;
+	return n;
+}
+
+static int append(Recorder *r, const uint8_t *rec, int n)
+{
+	if (r->full) {
+		return 0;
+	}
+	if (r->len + n > r->size) {
+		/* keep whole frames only, so a replay never ends halfway
+		   through one */
+		if (r->len > r->frameStart && r->frames > 0) {
+			r->frames--;
+		}
+		r->len = r->frameStart;
+		r->full = 1;
+		return 0;
+	}
+	for (int i = 0; i < n; i++) {
+		r->buf[r->len++] = rec[i];
+	}
+	return 1;
+}
+
+int recFrame(Recorder *r, int steps)
+{
+	uint8_t rec[8];
+	int n = 1;
+
+	if (r->full) {
+		return 0;
+	}
+	if (steps < 15) {
+		rec[0] = (REC_FRAME << 4) | steps;
+	} else {
+		rec[0] = (REC_FRAME << 4) | 15;
+		n += putVarint(rec + n, steps);
+	}
+	r->frameStart = r->len;
+	if (!append(r, rec, n)) {
+		return 0;
+	}
+	r->frames++;
+	return 1;
+}
+
+int recAccel(Recorder *r, int x, int y)
+{
+	uint8_t rec[12];
+	int n = 1;
+
+	rec[0] = REC_ACCEL << 4;
+	n += putVarint(rec + n, zigzag(x - r->state.accX));
+	n += putVarint(rec + n, zigzag(y - r->state.accY));
+	if (!append(r, rec, n)) {
+		return 0;
+	}
+	r->state.accX = x;
+	r->state.accY = y;
+	return 1;
+}
+
+int recTouch(Recorder *r, int pressed, int x, int y, uint32_t time)
+{
+	uint8_t rec[16];
+	int n = 1;
+
+	rec[0] = (REC_TOUCH << 4) | (pressed ? 1 : 0);
+	n += putVarint(rec + n, time - r->state.touchTime);
+	if (pressed) {
+		n += putVarint(rec + n, zigzag(x - r->state.touchX));
+		n += putVarint(rec + n, zigzag(y - r->state.touchY));
+	}
+	if (!append(r, rec, n)) {
+		return 0;
+	}
+	r->state.touchTime = time;
+	if (pressed) {
+		r->state.touchX = x;
+		r->state.touchY = y;
+	}
+	return 1;
+}
+
+int recTap(Recorder *r, int events)
+{
+	uint8_t rec[8];
+	int n = 1;
+
+	rec[0] = REC_TAP << 4;
+	n += putVarint(rec + n, events);
+	return append(r, rec, n);
+}
+
+int recSeed(Recorder *r, uint32_t seed)
+{
+	uint8_t rec[8];
+	int n = 1;
+
+	rec[0] = REC_SEED << 4;
+	n += putVarint(rec + n, seed);
+	return append(r, rec, n);
+}
+
+int recCal(Recorder *r, int offX, int offY)
+{
+	uint8_t rec[12];
+	int n = 1;
+
+	rec[0] = REC_CAL << 4;
+	n += putVarint(rec + n, zigzag(offX));
+	n += putVarint(rec + n, zigzag(offY));
+	return append(r, rec, n);
+}
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+static char *putDecimal(char *p, unsigned int v)
+{
+	char tmp[12];
+	int n = 0;
+	do {
+		tmp[n++] = '0' + v % 10;
+		v /= 10;
+	} while (v);
+	while (n) {
+		*p++ = tmp[--n];
+	}
+	return p;
+}
+
+void recDump(const Recorder *r, void (*put)(void *ctx, const char *line), void *ctx)
+{
+	char line[REC_DUMP_LINE * 2 + 3];
+	char *p = line;
+
+	*p++ = 'R';
+	*p++ = 'E';
+	*p++ = 'C';
+	*p++ = ' ';
+	p = putDecimal(p, r->len);
+	*p++ = ' ';
+	p = putDecimal(p, r->frames);
+	*p++ = '\r';
+	*p++ = '\n';
+	*p = 0;
+	put(ctx, line);
+
+	for (int i = 0; i < r->len; i += REC_DUMP_LINE) {
+		p = line;
+		for (int j = i; j < r->len && j < i + REC_DUMP_LINE; j++) {
+			*p++ = hexDigits[r->buf[j] >> 4];
+			*p++ = hexDigits[r->buf[j] & 15];
+		}
+		*p++ = '\r';
+		*p++ = '\n';
+		*p = 0;
+		put(ctx, line);
+	}
+	put(ctx, "END\r\n");
+}
+
+/* Read a varint at *pos; 0 if it runs past the end */
+static int getVarint(const Replay *p, int *pos, uint32_t *v)
+{
+	uint32_t value = 0;
+	int shift = 0;
+
+	for (;;) {
+		if (*pos >= p->size || shift > 28) {
+			return 0;
+		}
+		uint8_t b = p->data[(*pos)++];
+		value |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			*v = value;
+			return 1;
+		}
+		shift += 7;
+	}
+}
+
+/* Decode the record at pos into next, moving the delta state on */
+static void decodeNext(Replay *p)
+{
+	RecSample *s = &p->next;
+	int pos = p->pos;
+	uint32_t a = 0, b = 0, c = 0;
+	int ok = 1;
+
+	s->type = REC_END;
+	s->value = 0;
+	s->x = 0;
+	s->y = 0;
+	s->time = 0;
+	p->nextLen = 0;
+	if (pos >= p->size || p->bad) {
+		return;
+	}
+	int tag = p->data[pos++];
+	int type = tag >> 4;
+	int arg = tag & 15;
+
+	switch (type) {
+	case REC_FRAME:
+		if (arg == 15) {
+			ok = getVarint(p, &pos, &a);
+			arg = a;
+		}
+		s->value = arg;
+		break;
+	case REC_ACCEL:
+		ok = getVarint(p, &pos, &a) && getVarint(p, &pos, &b);
+		if (ok) {
+			p->state.accX += unzigzag(a);
+			p->state.accY += unzigzag(b);
+			s->x = p->state.accX;
+			s->y = p->state.accY;
+		}
+		break;
+	case REC_TOUCH:
+		ok = getVarint(p, &pos, &a);
+		if (ok && arg) {
+			ok = getVarint(p, &pos, &b) && getVarint(p, &pos, &c);
+		}
+		if (ok) {
+			p->state.touchTime += a;
+			if (arg) {
+				p->state.touchX += unzigzag(b);
+				p->state.touchY += unzigzag(c);
+			}
+			s->value = arg;
+			s->x = p->state.touchX;
+			s->y = p->state.touchY;
+			s->time = p->state.touchTime;
+		}
+		break;
+	case REC_TAP:
+		ok = getVarint(p, &pos, &a);
+		s->value = a;
+		break;
+	case REC_SEED:
+		ok = getVarint(p, &pos, &a);
+		s->time = a;
+		break;
+	case REC_CAL:
+		ok = getVarint(p, &pos, &a) && getVarint(p, &pos, &b);
+		s->x = unzigzag(a);
+		s->y = unzigzag(b);
+		break;
+	default:
+		ok = 0;
+		break;
+	}
+	if (!ok) {
+		p->bad = 1;
+		s->type = REC_END;
+		return;
+	}
+	s->type = type;
+	p->nextLen = pos - p->pos;
+}
+
+void replayInit(Replay *p, const uint8_t *data, int size)
+{
+	p->data = data;
+	p->size = size;
+	p->pos = 0;
+	p->bad = 0;
+	p->frames = 0;
+	stateInit(&p->state);
+	decodeNext(p);
+}
+
+int replayTake(Replay *p, int type, RecSample *s)
+{
+	if (p->next.type != type || type == REC_END) {
+		return 0;
+	}
+	*s = p->next;
+	p->pos += p->nextLen;
+	if (type == REC_FRAME) {
+		p->frames++;
+	}
+	decodeNext(p);
+	return 1;
+}
+
+int replayPeek(const Replay *p)
+{
+	return p->next.type;
+}
+
+static int hexValue(char c)
+{
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	} else if (c >= 'A' && c <= 'F') {
+		return c - 'A' + 10;
+	} else if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+int replayParseHex(const char *text, uint8_t *out, int max)
+{
+	int n = 0;
+
+	while (*text) {
+		/* a line counts if it is nothing but hex digit pairs */
+		const char *end = text;
+		int hex = 1;
+		while (*end && *end != '\n' && *end != '\r') {
+			if (hexValue(*end) < 0) {
+				hex = 0;
+			}
+			end++;
+		}
+		if (hex && (end - text) % 2 == 0) {
+			for (const char *c = text; c < end; c += 2) {
+				if (n == max) {
+					return -1;
+				}
+				out[n++] = (uint8_t)(hexValue(c[0]) << 4 | hexValue(c[1]));
+			}
+		}
+		text = end;
+		while (*text == '\n' || *text == '\r') {
+			text++;
+		}
+	}
+	return n;
+}
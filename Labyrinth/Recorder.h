@@ -0,0 +1,103 @@
+/* Labyrinth input recorder and replay
+ *
+ * Logs everything the game reads from the outside world - raw
+ * accelerometer samples, touch samples, accelerometer taps, the steps
+ * each frame owes and the maze seed - into a caller supplied buffer, so
+ * that a run can be played back exactly, on target or on the host, and
+ * frame times or SPI traffic compared between builds.
+ *
+ * The game is deterministic given these inputs, so replay needs no
+ * timestamps to line samples up: each input point asks for the next
+ * record of its kind with replayTake(), and there is none if nothing
+ * was recorded at that point (e.g. no accelerometer sample was ready).
+ *
+ * Records are a tag byte, type in the high nibble and a small argument
+ * in the low one, followed by varints. Accelerometer and touch values
+ * are zigzag coded deltas from the previous ones, so a still board
+ * costs three bytes a sample and a typical frame five or six.
+ *
+ * recDump() prints the log as hex lines; replayParseHex() reads them
+ * back.
+ */
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <stdint.h>
+
+/* Record types */
+#define REC_END           0
+#define REC_FRAME         1    /* a frame starts: physics steps it owes */
+#define REC_ACCEL         2    /* raw accelerometer x, y counts */
+#define REC_TOUCH         3    /* touch sample: pressed, x, y, time */
+#define REC_TAP           4    /* accelerometer event bits */
+#define REC_SEED          5    /* maze generator seed */
+#define REC_CAL           6    /* tilt offsets restored instead of captured */
+
+#define REC_DUMP_LINE     32   /* bytes per hex line */
+
+typedef struct recSample {
+	int type;
+	int value;             /* steps, pressed, event bits */
+	int x;
+	int y;
+	uint32_t time;         /* touch time, us; seed */
+} RecSample;
+
+/* Delta coding state, the same on both sides */
+typedef struct recState {
+	int accX;
+	int accY;
+	int touchX;
+	int touchY;
+	uint32_t touchTime;
+} RecState;
+
+typedef struct recorder {
+	uint8_t *buf;
+	int size;
+	int len;
+	int full;              /* ran out of room; the log stops at the last whole frame */
+	int frameStart;        /* where the current frame's records begin */
+	unsigned int frames;
+	RecState state;
+} Recorder;
+
+typedef struct replay {
+	const uint8_t *data;
+	int size;
+	int pos;
+	int bad;               /* a record ran past the end */
+	unsigned int frames;
+	RecState state;
+	RecSample next;        /* decoded record at pos, type REC_END at the end */
+	int nextLen;
+} Replay;
+
+void recInit(Recorder *r, uint8_t *buf, int size);
+
+/* Each returns 0 once the buffer is full; nothing more is logged */
+int recFrame(Recorder *r, int steps);
+int recAccel(Recorder *r, int x, int y);
+int recTouch(Recorder *r, int pressed, int x, int y, uint32_t time);
+int recTap(Recorder *r, int events);
+int recSeed(Recorder *r, uint32_t seed);
+int recCal(Recorder *r, int offX, int offY);
+
+/* Print the log, a line at a time: a "REC <bytes> <frames>" header,
+   hex lines and "END" */
+void recDump(const Recorder *r, void (*put)(void *ctx, const char *line), void *ctx);
+
+void replayInit(Replay *p, const uint8_t *data, int size);
+
+/* Take the next record if it is of this type. Returns 0, and leaves it,
+   if it is anything else or the log has ended. */
+int replayTake(Replay *p, int type, RecSample *s);
+
+/* Type of the next record, REC_END at the end */
+int replayPeek(const Replay *p);
+
+/* Bytes out of recDump() text; anything but hex lines is skipped.
+   Returns the number of bytes, or -1 if they don't fit in max. */
+int replayParseHex(const char *text, uint8_t *out, int max);
+
+#endif
@@ -0,0 +1,70 @@
+#include "Scene.h"
+
+void sceneInit(SceneManager *m)
+{
+	m->current = 0;
+	m->next = 0;
+	m->preloaded = 0;
+	m->changes = 0;
+}
+
+void sceneStart(SceneManager *m, const Scene *first)
+{
+	m->current = first;
+	m->next = 0;
+	if (first->preload != 0) {
+		first->preload(first->ctx);
+	}
+	if (first->enter != 0) {
+		first->enter(first->ctx);
+	}
+}
+
+void sceneChange(SceneManager *m, const Scene *next)
+{
+	if (m->next == 0 && m->current != 0 && m->current->exit != 0) {
+		m->current->exit(m->current->ctx);
+	}
+	m->next = next;
+	m->preloaded = 0;
+}
+
+void sceneFrame(SceneManager *m, int steps, int busy)
+{
+	const Scene *s = m->current;
+
+	if (m->next != 0) {
+		/* the way out has started; get the next scene ready behind it */
+		if (!m->preloaded) {
+			if (m->next->preload != 0) {
+				m->next->preload(m->next->ctx);
+			}
+			m->preloaded = 1;
+		}
+		if (busy) {
+			return;
+		}
+		m->current = s = m->next;
+		m->next = 0;
+		m->changes++;
+		if (s->enter != 0) {
+			s->enter(s->ctx);
+		}
+		return;
+	}
+	if (s == 0) {
+		return;
+	}
+	if (s->update != 0) {
+		s->update(s->ctx, steps);
+	}
+	/* update may have asked for a change; don't draw a scene on its way out */
+	if (m->next == 0 && s->render != 0) {
+		s->render(s->ctx);
+	}
+}
+
+int sceneChanging(const SceneManager *m)
+{
+	return m->next != 0;
+}
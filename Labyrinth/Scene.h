@@ -0,0 +1,54 @@
+/* Labyrinth scene manager
+ *
+ * Each screen of the game (title, instructions, level, play again...)
+ * is a scene: a set of callbacks the one main loop calls, instead of a
+ * loop of its own.
+ *
+ *   preload  optional; prepare data, e.g. parse or generate the level
+ *   enter    draw the screen and set up its state
+ *   update   once per frame, with the physics steps the frame owes
+ *   render   once per frame after update; send what changed
+ *   exit     start the way out, e.g. a wipe on the animation timeline
+ *
+ * sceneChange() calls the current scene's exit at once, then the next
+ * scene's preload on the following frame, while the outgoing animation
+ * is still playing. The next scene is entered once sceneFrame() is told
+ * that nothing is animating any more. Any callback may be NULL.
+ */
+#ifndef SCENE_H
+#define SCENE_H
+
+typedef struct scene {
+	const char *name;
+	void (*preload)(void *ctx);
+	void (*enter)(void *ctx);
+	void (*update)(void *ctx, int steps);
+	void (*render)(void *ctx);
+	void (*exit)(void *ctx);
+	void *ctx;
+} Scene;
+
+typedef struct sceneManager {
+	const Scene *current;
+	const Scene *next;     /* being changed to, or NULL */
+	int preloaded;
+	unsigned int changes;
+} SceneManager;
+
+void sceneInit(SceneManager *m);
+
+/* Enter the first scene, without preload or transition */
+void sceneStart(SceneManager *m, const Scene *first);
+
+/* Leave the current scene for next. Calling it again before next has
+   been entered changes the destination. */
+void sceneChange(SceneManager *m, const Scene *next);
+
+/* One frame: update and render the current scene, or carry on with a
+   change. busy is non-zero while the outgoing scene still animates. */
+void sceneFrame(SceneManager *m, int steps, int busy);
+
+/* Non-zero between sceneChange() and entering the next scene */
+int sceneChanging(const SceneManager *m);
+
+#endif
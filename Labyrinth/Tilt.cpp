@@ -0,0 +1,112 @@
+#include "Tilt.h"
+
+/* Smoothing applied to the speed estimate that drives the adaptive alpha */
+#define TILT_SPEED_ALPHA  64
+
+static int absInt(int v)
+{
+	return (v < 0) ? -v : v;
+}
+
+static int deadZone(int v, int dz)
+{
+	if (v > dz) {
+		return v - dz;
+	} else if (v < -dz) {
+		return v + dz;
+	}
+	return 0;
+}
+
+void tiltInit(Tilt *t, int minAlpha, int beta, int deadZone)
+{
+	t->offX = 0;
+	t->offY = 0;
+	t->calibrated = 0;
+	t->minAlpha = minAlpha;
+	t->beta = beta;
+	t->deadZone = deadZone;
+	t->x = 0;
+	t->y = 0;
+	t->dx = 0;
+	t->dy = 0;
+	t->primed = 0;
+	t->calSumX = 0;
+	t->calSumY = 0;
+	t->calCount = 0;
+	t->calTarget = 0;
+}
+
+void tiltCalibrate(Tilt *t, int samples)
+{
+	t->calSumX = 0;
+	t->calSumY = 0;
+	t->calCount = 0;
+	t->calTarget = samples;
+}
+
+int tiltCalibrating(const Tilt *t)
+{
+	return t->calTarget > 0;
+}
+
+void tiltSetOffsets(Tilt *t, int offX, int offY)
+{
+	t->offX = offX;
+	t->offY = offY;
+	t->calibrated = 1;
+	t->primed = 0;
+}
+
+void tiltUpdate(Tilt *t, int rawX, int rawY)
+{
+	if (t->calTarget > 0) {
+		t->calSumX += rawX;
+		t->calSumY += rawY;
+		if (++t->calCount == t->calTarget) {
+			int offX = t->calSumX / t->calCount;
+			int offY = t->calSumY / t->calCount;
+			if (absInt(offX) <= TILT_MAX_OFFSET && absInt(offY) <= TILT_MAX_OFFSET) {
+				tiltSetOffsets(t, offX, offY);
+			}
+			t->calTarget = 0;
+		}
+	}
+
+	int x = (rawX - t->offX) << TILT_Q;
+	int y = (rawY - t->offY) << TILT_Q;
+
+	if (!t->primed) {
+		t->x = x;
+		t->y = y;
+		t->dx = 0;
+		t->dy = 0;
+		t->primed = 1;
+		return;
+	}
+
+	// track how fast the tilt is changing; fast moves get less smoothing
+	int dx = x - t->x;
+	int dy = y - t->y;
+	t->dx += ((dx - t->dx) * TILT_SPEED_ALPHA) >> TILT_Q;
+	t->dy += ((dy - t->dy) * TILT_SPEED_ALPHA) >> TILT_Q;
+
+	int speed = (absInt(t->dx) + absInt(t->dy)) >> TILT_Q;
+	int alpha = t->minAlpha + ((speed * t->beta) >> TILT_Q);
+	if (alpha > TILT_ONE) {
+		alpha = TILT_ONE;
+	}
+
+	t->x += (dx * alpha) >> TILT_Q;
+	t->y += (dy * alpha) >> TILT_Q;
+}
+
+int tiltX(const Tilt *t)
+{
+	return deadZone(t->x >> TILT_Q, t->deadZone);
+}
+
+int tiltY(const Tilt *t)
+{
+	return deadZone(t->y >> TILT_Q, t->deadZone);
+}
@@ -0,0 +1,63 @@
+/* Labyrinth tilt processing
+ *
+ * Sits between the raw MMA8451Q counts and the marble. Every sample is
+ * offset-corrected, smoothed by an adaptive (one-euro style) IIR filter
+ * and passed through a dead-zone, all in integer math and O(1).
+ *
+ * Inputs and outputs are in accelerometer counts (4096 counts = 1g).
+ * Filter coefficients are Q8 (256 = 1.0).
+ */
+#ifndef TILT_H
+#define TILT_H
+
+#define TILT_Q            8
+#define TILT_ONE          (1 << TILT_Q)
+#define TILT_MAX_OFFSET   1024    /* reject calibrations further than 0.25g from level */
+
+typedef struct tilt {
+	/* Calibration offsets subtracted from every raw sample */
+	int offX;
+	int offY;
+	int calibrated;
+
+	/* Smoothing: alpha = minAlpha + beta*speed, clamped to TILT_ONE.
+	   beta = 0 gives a plain first-order IIR with alpha = minAlpha */
+	int minAlpha;
+	int beta;
+	/* Filtered output inside +/- deadZone counts reads as level */
+	int deadZone;
+
+	/* Filter state, Q8 counts */
+	int x;
+	int y;
+	int dx;
+	int dy;
+	int primed;
+
+	/* One-shot calibration capture */
+	int calSumX;
+	int calSumY;
+	int calCount;
+	int calTarget;
+} Tilt;
+
+/* Set up a filter with no offsets */
+void tiltInit(Tilt *t, int minAlpha, int beta, int deadZone);
+
+/* Average the next `samples` raw readings into new offsets. The board
+   should be held level meanwhile; a result beyond TILT_MAX_OFFSET is
+   discarded and the previous offsets are kept. */
+void tiltCalibrate(Tilt *t, int samples);
+int tiltCalibrating(const Tilt *t);
+
+/* Restore offsets captured earlier (e.g. kept across a reset) */
+void tiltSetOffsets(Tilt *t, int offX, int offY);
+
+/* Feed one raw sample */
+void tiltUpdate(Tilt *t, int rawX, int rawY);
+
+/* Filtered, offset-corrected and dead-zoned acceleration, counts */
+int tiltX(const Tilt *t);
+int tiltY(const Tilt *t);
+
+#endif
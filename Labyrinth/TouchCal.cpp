@@ -0,0 +1,140 @@
+#include "TouchCal.h"
+
+#define TOUCHCAL_HALF   (1 << (TOUCHCAL_Q - 1))
+
+/* Screen point in the current orientation -> panel point (orientation 0).
+   Inverse of the rotations composed in touchCalSetOrientation(). */
+static void screenToPanel(const TouchCal *cal, int x, int y, int *xp, int *yp)
+{
+	int w = cal->panelWidth - 1;
+	int h = cal->panelHeight - 1;
+
+	switch (cal->orientation) {
+	case 1:
+		*xp = w - y;
+		*yp = x;
+		break;
+	case 2:
+		*xp = w - x;
+		*yp = h - y;
+		break;
+	case 3:
+		*xp = y;
+		*yp = h - x;
+		break;
+	default:
+		*xp = x;
+		*yp = y;
+		break;
+	}
+}
+
+/* One row of the affine solution by Cramer's rule, Q16 */
+static void solveRow(const int *rx, const int *ry, const int *t, int64_t det,
+                     int32_t *a, int32_t *b, int32_t *c)
+{
+	int64_t na = (int64_t)(t[0] - t[2]) * (ry[1] - ry[2])
+	           - (int64_t)(t[1] - t[2]) * (ry[0] - ry[2]);
+	int64_t nb = (int64_t)(rx[0] - rx[2]) * (t[1] - t[2])
+	           - (int64_t)(t[0] - t[2]) * (rx[1] - rx[2]);
+	int64_t nc = (int64_t)ry[0] * ((int64_t)rx[2] * t[1] - (int64_t)rx[1] * t[2])
+	           + (int64_t)ry[1] * ((int64_t)rx[0] * t[2] - (int64_t)rx[2] * t[0])
+	           + (int64_t)ry[2] * ((int64_t)rx[1] * t[0] - (int64_t)rx[0] * t[1]);
+
+	*a = (int32_t)((na << TOUCHCAL_Q) / det);
+	*b = (int32_t)((nb << TOUCHCAL_Q) / det);
+	*c = (int32_t)((nc << TOUCHCAL_Q) / det);
+}
+
+void touchCalInit(TouchCal *cal, int panelWidth, int panelHeight, int rawMax)
+{
+	cal->panelWidth = panelWidth;
+	cal->panelHeight = panelHeight;
+	cal->a = (int32_t)(((int64_t)(panelWidth - 1) << TOUCHCAL_Q) / rawMax);
+	cal->b = 0;
+	cal->c = 0;
+	cal->d = 0;
+	cal->e = (int32_t)(((int64_t)(panelHeight - 1) << TOUCHCAL_Q) / rawMax);
+	cal->f = 0;
+	touchCalSetOrientation(cal, 0);
+}
+
+int touchCalSolve(TouchCal *cal, const int rawX[3], const int rawY[3],
+                  const int scrX[3], const int scrY[3])
+{
+	int px[3], py[3];
+	int64_t det = (int64_t)(rawX[0] - rawX[2]) * (rawY[1] - rawY[2])
+	            - (int64_t)(rawX[1] - rawX[2]) * (rawY[0] - rawY[2]);
+
+	if (det == 0) {
+		return 0;
+	}
+	for (int i = 0; i < 3; i++) {
+		screenToPanel(cal, scrX[i], scrY[i], &px[i], &py[i]);
+	}
+	solveRow(rawX, rawY, px, det, &cal->a, &cal->b, &cal->c);
+	solveRow(rawX, rawY, py, det, &cal->d, &cal->e, &cal->f);
+	touchCalSetOrientation(cal, cal->orientation);
+	return 1;
+}
+
+void touchCalSetOrientation(TouchCal *cal, int orientation)
+{
+	int32_t w = (int32_t)(cal->panelWidth - 1) << TOUCHCAL_Q;
+	int32_t h = (int32_t)(cal->panelHeight - 1) << TOUCHCAL_Q;
+
+	cal->orientation = orientation & 3;
+	switch (cal->orientation) {
+	case 1:
+		/* x = yp, y = w - xp */
+		cal->sa = cal->d;  cal->sb = cal->e;  cal->sc = cal->f;
+		cal->sd = -cal->a; cal->se = -cal->b; cal->sf = w - cal->c;
+		break;
+	case 2:
+		/* x = w - xp, y = h - yp */
+		cal->sa = -cal->a; cal->sb = -cal->b; cal->sc = w - cal->c;
+		cal->sd = -cal->d; cal->se = -cal->e; cal->sf = h - cal->f;
+		break;
+	case 3:
+		/* x = h - yp, y = xp */
+		cal->sa = -cal->d; cal->sb = -cal->e; cal->sc = h - cal->f;
+		cal->sd = cal->a;  cal->se = cal->b;  cal->sf = cal->c;
+		break;
+	default:
+		cal->sa = cal->a;  cal->sb = cal->b;  cal->sc = cal->c;
+		cal->sd = cal->d;  cal->se = cal->e;  cal->sf = cal->f;
+		break;
+	}
+	if (cal->orientation & 1) {
+		cal->width = cal->panelHeight;
+		cal->height = cal->panelWidth;
+	} else {
+		cal->width = cal->panelWidth;
+		cal->height = cal->panelHeight;
+	}
+}
+
+int touchCalMap(const TouchCal *cal, int rawX, int rawY, int *x, int *y)
+{
+	int inside = 1;
+	int sx = (cal->sa * rawX + cal->sb * rawY + cal->sc + TOUCHCAL_HALF) >> TOUCHCAL_Q;
+	int sy = (cal->sd * rawX + cal->se * rawY + cal->sf + TOUCHCAL_HALF) >> TOUCHCAL_Q;
+
+	if (sx < 0) {
+		sx = 0;
+		inside = 0;
+	} else if (sx > cal->width - 1) {
+		sx = cal->width - 1;
+		inside = 0;
+	}
+	if (sy < 0) {
+		sy = 0;
+		inside = 0;
+	} else if (sy > cal->height - 1) {
+		sy = cal->height - 1;
+		inside = 0;
+	}
+	*x = sx;
+	*y = sy;
+	return inside;
+}
@@ -0,0 +1,53 @@
+/* Labyrinth touch calibration
+ *
+ * Maps raw touch controller readings (MYTOUCH or STMPE610, 12 bit) to
+ * screen pixels with an affine matrix, which covers offset, scale,
+ * rotation and skew of the panel relative to the display. The matrix is
+ * solved from three touched targets and kept in panel coordinates
+ * (display orientation 0); touchCalSetOrientation() folds the
+ * SPI_TFT_ILI9341::set_orientation() rotation into a second matrix, so a
+ * sample costs two integer multiply-adds per axis whatever the rotation.
+ *
+ * Matrix entries are Q16 (65536 = 1.0 pixel per raw count).
+ */
+#ifndef TOUCHCAL_H
+#define TOUCHCAL_H
+
+#include <stdint.h>
+
+#define TOUCHCAL_Q      16
+
+typedef struct touchCal {
+	/* raw -> panel pixels: xp = a*rx + b*ry + c, yp = d*rx + e*ry + f */
+	int32_t a, b, c;
+	int32_t d, e, f;
+	/* Panel size at orientation 0 (240 x 320 for the ILI9341) */
+	int panelWidth;
+	int panelHeight;
+
+	/* raw -> screen pixels in the current orientation */
+	int orientation;
+	int32_t sa, sb, sc;
+	int32_t sd, se, sf;
+	int width;
+	int height;
+} TouchCal;
+
+/* Start with raw 0..rawMax on both axes spread over the whole panel */
+void touchCalInit(TouchCal *cal, int panelWidth, int panelHeight, int rawMax);
+
+/* Solve the matrix from three raw readings and the screen points (in the
+   current orientation) that were touched to get them. The targets should
+   be far apart and not in a line, e.g. near three corners. Returns 0 and
+   keeps the old matrix if the points are degenerate. */
+int touchCalSolve(TouchCal *cal, const int rawX[3], const int rawY[3],
+                  const int scrX[3], const int scrY[3]);
+
+/* Follow the display orientation, 0-3 as in set_orientation() */
+void touchCalSetOrientation(TouchCal *cal, int orientation);
+
+/* Map a raw reading to screen pixels, clamped to the screen. Returns 0
+   if the reading fell outside the screen before clamping. */
+int touchCalMap(const TouchCal *cal, int rawX, int rawY, int *x, int *y);
+
+#endif
@@ -0,0 +1,107 @@
+#include "Tween.h"
+
+void timelineInit(Timeline *t)
+{
+	t->now = 0;
+	timelineClear(t);
+}
+
+int timelineAdd(Timeline *t, uint32_t delayUs, uint32_t durationUs, int from, int to, int ease,
+                TweenApply apply, TweenDone done, void *ctx)
+{
+	for (int i = 0; i < TIMELINE_MAX; i++) {
+		Tween *w = &t->tweens[i];
+		if (w->active) {
+			continue;
+		}
+		w->start = t->now + delayUs;
+		w->duration = durationUs;
+		w->from = from;
+		w->to = to;
+		w->value = from;
+		w->ease = ease;
+		w->active = 1;
+		w->started = 0;
+		w->apply = apply;
+		w->done = done;
+		w->ctx = ctx;
+		return i;
+	}
+	return -1;
+}
+
+int tweenEase(int ease, uint32_t elapsed, uint32_t duration)
+{
+	int p;
+
+	if (elapsed >= duration) {
+		return 256;
+	}
+	p = (int)(((uint64_t)elapsed << 8) / duration);
+	if (ease == TWEEN_EASE_IN) {
+		return (p * p) >> 8;
+	} else if (ease == TWEEN_EASE_OUT) {
+		return 256 - (((256 - p) * (256 - p)) >> 8);
+	}
+	return p;
+}
+
+void timelineUpdate(Timeline *t, uint32_t elapsedUs)
+{
+	t->now += elapsedUs;
+	for (int i = 0; i < TIMELINE_MAX; i++) {
+		Tween *w = &t->tweens[i];
+		/* wrap-safe: not started yet */
+		int32_t elapsed = (int32_t)(t->now - w->start);
+		if (!w->active || elapsed < 0) {
+			continue;
+		}
+		int p = tweenEase(w->ease, elapsed, w->duration);
+		int value = w->from + (w->to - w->from) * p / 256;
+		if (!w->started) {
+			/* always show the first value, even if a late frame
+			   has already moved it on */
+			w->started = 1;
+			if (w->apply != 0) {
+				w->apply(w->ctx, w->from);
+			}
+		}
+		if (value != w->value) {
+			w->value = value;
+			if (w->apply != 0) {
+				w->apply(w->ctx, value);
+			}
+		}
+		if (p == 256) {
+			// free the slot first so done can reuse it
+			w->active = 0;
+			if (w->done != 0) {
+				w->done(w->ctx);
+			}
+		}
+	}
+}
+
+int timelineBusy(const Timeline *t)
+{
+	for (int i = 0; i < TIMELINE_MAX; i++) {
+		if (t->tweens[i].active) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void timelineCancel(Timeline *t, int slot)
+{
+	if (slot >= 0 && slot < TIMELINE_MAX) {
+		t->tweens[slot].active = 0;
+	}
+}
+
+void timelineClear(Timeline *t)
+{
+	for (int i = 0; i < TIMELINE_MAX; i++) {
+		t->tweens[i].active = 0;
+	}
+}
@@ -0,0 +1,75 @@
+/* Labyrinth animation timeline
+ *
+ * Animations are tweens: a value that goes from one number to another
+ * over a duration, with an easing curve. The main loop advances the
+ * timeline once per frame by the time the frame took, and each tween
+ * that moved hands its new value to an apply callback that draws it:
+ * a ball sliding into a hole, a screen wiped a few rows at a time, a
+ * message typed out a character at a time. Nothing waits, so input,
+ * physics and background work carry on between animation steps.
+ *
+ * A tween starts after a delay, so a sequence is added all at once with
+ * staggered delays. apply always gets the from value first, so it can
+ * set up (e.g. position the text cursor). When it ends, apply gets the
+ * final value and then the done callback, if any, runs; done may add
+ * further tweens. A tween with neither callback is just a pause that
+ * keeps the timeline busy.
+ *
+ * Times are microseconds. Values are ints; eased progress is Q8.
+ */
+#ifndef TWEEN_H
+#define TWEEN_H
+
+#include <stdint.h>
+
+#define TIMELINE_MAX      8
+
+/* Easing curves */
+#define TWEEN_LINEAR      0
+#define TWEEN_EASE_IN     1     /* starts slow, like something falling */
+#define TWEEN_EASE_OUT    2     /* ends slow */
+
+typedef void (*TweenApply)(void *ctx, int value);
+typedef void (*TweenDone)(void *ctx);
+
+typedef struct tween {
+	uint32_t start;        /* timeline time it starts at, us */
+	uint32_t duration;
+	int from;
+	int to;
+	int value;             /* last value applied */
+	uint8_t ease;
+	uint8_t active;
+	uint8_t started;
+	TweenApply apply;
+	TweenDone done;
+	void *ctx;
+} Tween;
+
+typedef struct timeline {
+	uint32_t now;          /* us */
+	Tween tweens[TIMELINE_MAX];
+} Timeline;
+
+void timelineInit(Timeline *t);
+
+/* Add a tween starting delayUs from now. apply and done may be NULL.
+   Returns its slot, or -1 if the timeline is full. */
+int timelineAdd(Timeline *t, uint32_t delayUs, uint32_t durationUs, int from, int to, int ease,
+                TweenApply apply, TweenDone done, void *ctx);
+
+/* Advance by elapsedUs, calling apply for every running tween whose
+   value changed and finishing those that ended */
+void timelineUpdate(Timeline *t, uint32_t elapsedUs);
+
+/* Non-zero while any tween is waiting to start or running */
+int timelineBusy(const Timeline *t);
+
+/* Drop a tween, or all of them, without calling done */
+void timelineCancel(Timeline *t, int slot);
+void timelineClear(Timeline *t);
+
+/* Eased progress, Q8 (0..256), after elapsed of duration */
+int tweenEase(int ease, uint32_t elapsed, uint32_t duration);
+
+#endif
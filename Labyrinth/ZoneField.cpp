@@ -0,0 +1,110 @@
+#include "ZoneField.h"
+
+void zoneFieldInit(ZoneField *f, int width, int height)
+{
+	f->cols = (width + (1 << ZONE_FIELD_SHIFT) - 1) >> ZONE_FIELD_SHIFT;
+	f->rows = (height + (1 << ZONE_FIELD_SHIFT) - 1) >> ZONE_FIELD_SHIFT;
+	if (f->cols * f->rows > ZONE_FIELD_MAX_CELLS) {
+		/* keep the top of a taller screen; lookups below it find nothing */
+		f->rows = ZONE_FIELD_MAX_CELLS / f->cols;
+	}
+	f->numZones = 0;
+	for (int i = 0; i < f->cols * f->rows; i++) {
+		f->zone[i] = ZONE_FIELD_NONE;
+		f->dist[i] = ZONE_FIELD_FAR;
+	}
+}
+
+static int chebyshev(const FieldZone *z, int x, int y)
+{
+	int dx = x - z->x;
+	int dy = y - z->y;
+	if (dx < 0) {
+		dx = -dx;
+	}
+	if (dy < 0) {
+		dy = -dy;
+	}
+	return dx > dy ? dx : dy;
+}
+
+int zoneFieldAdd(ZoneField *f, int kind, int index, int cx, int cy, int reach)
+{
+	if (f->numZones == ZONE_FIELD_MAX_ZONES) {
+		return 0;
+	}
+	int n = f->numZones++;
+	FieldZone *z = &f->zones[n];
+	z->x = cx;
+	z->y = cy;
+	z->reach = reach;
+	z->kind = kind;
+	z->index = index;
+
+	/* only the cells in range can change */
+	int extent = reach + ZONE_FIELD_RANGE;
+	int c0 = (cx - extent) >> ZONE_FIELD_SHIFT;
+	int c1 = (cx + extent) >> ZONE_FIELD_SHIFT;
+	int r0 = (cy - extent) >> ZONE_FIELD_SHIFT;
+	int r1 = (cy + extent) >> ZONE_FIELD_SHIFT;
+	if (c0 < 0) {
+		c0 = 0;
+	}
+	if (c1 > f->cols - 1) {
+		c1 = f->cols - 1;
+	}
+	if (r0 < 0) {
+		r0 = 0;
+	}
+	if (r1 > f->rows - 1) {
+		r1 = f->rows - 1;
+	}
+	int half = 1 << (ZONE_FIELD_SHIFT - 1);
+	for (int r = r0; r <= r1; r++) {
+		int y = (r << ZONE_FIELD_SHIFT) + half;
+		for (int c = c0; c <= c1; c++) {
+			int d = chebyshev(z, (c << ZONE_FIELD_SHIFT) + half, y) - reach;
+			if (d > ZONE_FIELD_RANGE) {
+				continue;
+			}
+			int i = r * f->cols + c;
+			if (d < f->dist[i]) {
+				f->dist[i] = d < -128 ? -128 : d;
+				f->zone[i] = n;
+			}
+		}
+	}
+	return 1;
+}
+
+static int cellOf(const ZoneField *f, int x, int y)
+{
+	int c = x >> ZONE_FIELD_SHIFT;
+	int r = y >> ZONE_FIELD_SHIFT;
+	if (x < 0 || y < 0 || c >= f->cols || r >= f->rows) {
+		return -1;
+	}
+	return r * f->cols + c;
+}
+
+int zoneFieldNearest(const ZoneField *f, int x, int y, int *dist)
+{
+	int i = cellOf(f, x, y);
+	if (i < 0 || f->zone[i] == ZONE_FIELD_NONE) {
+		*dist = ZONE_FIELD_FAR;
+		return -1;
+	}
+	*dist = f->dist[i];
+	return f->zone[i];
+}
+
+int zoneFieldHit(const ZoneField *f, int x, int y)
+{
+	int i = cellOf(f, x, y);
+	/* every point of the cell is within half a cell of its centre */
+	if (i < 0 || f->zone[i] == ZONE_FIELD_NONE || f->dist[i] > 1 << (ZONE_FIELD_SHIFT - 1)) {
+		return -1;
+	}
+	const FieldZone *z = &f->zones[f->zone[i]];
+	return chebyshev(z, x, y) <= z->reach ? f->zone[i] : -1;
+}
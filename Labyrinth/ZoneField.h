@@ -0,0 +1,61 @@
+/* Labyrinth zone distance field
+ *
+ * A coarse grid over the screen, built once per level, that stores for
+ * each 4x4 px cell the hole or goal whose edge is nearest and how far
+ * away that edge is. "Is the ball in a zone?" and "how close is the
+ * nearest one?" are then a table lookup and one compare, whatever the
+ * number of holes.
+ *
+ * Distances are Chebyshev (the larger of |dx| and |dy|) from the cell
+ * centre to the zone's edge, negative inside, so they match the square
+ * fall-in test the game uses. Zones whose edges come within a cell of
+ * each other may resolve to either one.
+ */
+#ifndef ZONEFIELD_H
+#define ZONEFIELD_H
+
+#include <stdint.h>
+
+#define ZONE_FIELD_SHIFT      2       /* 4 px cells */
+#define ZONE_FIELD_MAX_CELLS  4800    /* 320x240 at 4 px */
+#define ZONE_FIELD_MAX_ZONES  80
+#define ZONE_FIELD_RANGE      64      /* px around a zone that get a distance */
+#define ZONE_FIELD_FAR        127     /* distance of cells out of range */
+#define ZONE_FIELD_NONE       0xFF    /* cell zone when nothing is in range */
+
+typedef struct fieldZone {
+	int16_t x;             /* centre */
+	int16_t y;
+	uint8_t reach;         /* the point is in the zone within this of the
+	                          centre on both axes */
+	uint8_t kind;          /* caller's, e.g. GRID_HOLE or GRID_GOAL */
+	uint16_t index;        /* caller's index, e.g. into the hole array */
+} FieldZone;
+
+typedef struct zoneField {
+	int cols;
+	int rows;
+
+	FieldZone zones[ZONE_FIELD_MAX_ZONES];
+	int numZones;
+
+	uint8_t zone[ZONE_FIELD_MAX_CELLS];   /* nearest zone, or ZONE_FIELD_NONE */
+	int8_t dist[ZONE_FIELD_MAX_CELLS];    /* to its edge, px */
+} ZoneField;
+
+/* Empty field covering width x height pixels */
+void zoneFieldInit(ZoneField *f, int width, int height);
+
+/* Add a zone and stamp its distances into the cells around it; returns
+   0 when the field is full */
+int zoneFieldAdd(ZoneField *f, int kind, int index, int cx, int cy, int reach);
+
+/* Nearest zone to x,y (a number into f->zones) or -1 if none is within
+   ZONE_FIELD_RANGE; *dist gets the distance to its edge at cell
+   precision, ZONE_FIELD_FAR when there is none */
+int zoneFieldNearest(const ZoneField *f, int x, int y, int *dist);
+
+/* Zone x,y is in, exactly, or -1 */
+int zoneFieldHit(const ZoneField *f, int x, int y);
+
+#endif
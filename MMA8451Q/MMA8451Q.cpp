@@ -24,15 +24,63 @@
 #define REG_OUT_Y_MSB     0x03
 #define REG_OUT_Z_MSB     0x05
 
+#define REG_INT_SOURCE    0x0C
+#define REG_PL_STATUS     0x10
+#define REG_PL_CFG        0x11
+#define REG_PL_COUNT      0x12
+#define REG_TRANSIENT_CFG 0x1D
+#define REG_TRANSIENT_SRC 0x1E
+#define REG_TRANSIENT_THS 0x1F
+#define REG_TRANSIENT_CNT 0x20
+#define REG_PULSE_CFG     0x21
+#define REG_PULSE_SRC     0x22
+#define REG_PULSE_THSX    0x23
+#define REG_PULSE_THSY    0x24
+#define REG_PULSE_THSZ    0x25
+#define REG_PULSE_TMLT    0x26
+#define REG_PULSE_LTCY    0x27
+#define REG_PULSE_WIND    0x28
+#define REG_CTRL_REG_3    0x2C
+#define REG_CTRL_REG_4    0x2D
+#define REG_CTRL_REG_5    0x2E
+
+#define CTRL_REG_1_ACTIVE 0x01
+
+#define INT_EN_PULSE      0x08
+#define INT_EN_LNDPRT     0x10
+#define INT_EN_TRANS      0x20
+
+#define SRC_PULSE         0x08
+#define SRC_LNDPRT        0x10
+#define SRC_TRANS         0x20
+
+#define PULSE_CFG_ELE     0x40
+#define PULSE_CFG_XYZ     0x3F  // single and double pulse on every axis
+#define PULSE_SRC_EA      0x80
+#define PULSE_SRC_DPE     0x08
+#define TRANSIENT_CFG_ELE 0x10
+#define TRANSIENT_CFG_XYZ 0x0E
+#define TRANSIENT_SRC_EA  0x40
+#define PL_CFG_DBCNTM     0x80
+#define PL_CFG_PL_EN      0x40
+#define PL_STATUS_NEWLP   0x80
+
 #define UINT14_MAX        16383
 
-MMA8451Q::MMA8451Q(PinName sda, PinName scl, int addr) : m_i2c(sda, scl), m_addr(addr) {
+MMA8451Q::MMA8451Q(PinName sda, PinName scl, int addr) : m_i2c(sda, scl), m_addr(addr),
+        m_irq(NULL), m_handler(NULL), m_pending(0), m_intEnable(0), m_orientation(PORTRAIT_UP),
+        m_queue(NULL), m_sampleInFlight(0), m_sampleNew(0) {
+    m_latched[0] = m_latched[1] = m_latched[2] = 0;
+    // the sensor supports 400 kHz fast mode
+    m_i2c.frequency(400000);
     // activate the peripheral
     uint8_t data[2] = {REG_CTRL_REG_1, 0x01};
     writeRegs(data, 2);
 }
 
-MMA8451Q::~MMA8451Q() { }
+MMA8451Q::~MMA8451Q() {
+    delete m_irq;
+}
 
 uint8_t MMA8451Q::getWhoAmI() {
     uint8_t who_am_i = 0;
@@ -58,11 +106,172 @@ void MMA8451Q::getAccAllAxis(float * res) {
     res[2] = getAccZ();
 }
 
+void MMA8451Q::setQueue(I2CQueue *queue) {
+    m_queue = queue;
+}
+
+int MMA8451Q::requestAccAllAxis() {
+    if (m_queue == NULL || m_sampleInFlight)
+        return -1;
+    m_sampleInFlight = 1;
+    if (m_queue->queueRead(m_addr, REG_OUT_X_MSB, m_sample, 6, &MMA8451Q::sampleDone, this) != I2C_QUEUE_OK) {
+        m_sampleInFlight = 0;
+        return -1;
+    }
+    return 0;
+}
+
+void MMA8451Q::sampleDone(void *context, int status) {
+    MMA8451Q *self = (MMA8451Q *)context;
+    if (status == I2C_QUEUE_OK) {
+        for (int i = 0; i < 3; i++) {
+            self->m_latched[i] = toAcc(&self->m_sample[2*i]);
+        }
+        self->m_sampleNew = 1;
+    }
+    self->m_sampleInFlight = 0;
+}
+
+int MMA8451Q::getLatchedAccAllAxisRaw(int16_t * res) {
+    int isNew;
+    __disable_irq();
+    res[0] = m_latched[0];
+    res[1] = m_latched[1];
+    res[2] = m_latched[2];
+    isNew = m_sampleNew;
+    m_sampleNew = 0;
+    __enable_irq();
+    return isNew;
+}
+
+void MMA8451Q::enableTapDetection(uint8_t threshold, uint8_t timeLimit, uint8_t latency, uint8_t window) {
+    standby();
+    writeReg(REG_PULSE_CFG, PULSE_CFG_ELE | PULSE_CFG_XYZ);
+    writeReg(REG_PULSE_THSX, threshold);
+    writeReg(REG_PULSE_THSY, threshold);
+    writeReg(REG_PULSE_THSZ, threshold);
+    writeReg(REG_PULSE_TMLT, timeLimit);
+    writeReg(REG_PULSE_LTCY, latency);
+    writeReg(REG_PULSE_WIND, window);
+    m_intEnable |= INT_EN_PULSE;
+    writeReg(REG_CTRL_REG_4, m_intEnable);
+    activate();
+}
+
+void MMA8451Q::enableShakeDetection(uint8_t threshold, uint8_t debounce) {
+    standby();
+    writeReg(REG_TRANSIENT_CFG, TRANSIENT_CFG_ELE | TRANSIENT_CFG_XYZ);
+    writeReg(REG_TRANSIENT_THS, threshold & 0x7F);
+    writeReg(REG_TRANSIENT_CNT, debounce);
+    m_intEnable |= INT_EN_TRANS;
+    writeReg(REG_CTRL_REG_4, m_intEnable);
+    activate();
+}
+
+void MMA8451Q::enableOrientationDetection(uint8_t debounce) {
+    standby();
+    writeReg(REG_PL_CFG, PL_CFG_DBCNTM | PL_CFG_PL_EN);
+    writeReg(REG_PL_COUNT, debounce);
+    m_intEnable |= INT_EN_LNDPRT;
+    writeReg(REG_CTRL_REG_4, m_intEnable);
+    activate();
+}
+
+void MMA8451Q::attachEvents(PinName irq, void (*handler)(int events)) {
+    standby();
+    writeReg(REG_CTRL_REG_3, 0x00);   // active low, push-pull
+    writeReg(REG_CTRL_REG_5, 0x00);   // every source on INT2
+    activate();
+
+    m_handler = handler;
+    if (m_irq == NULL) {
+        m_irq = new InterruptIn(irq);
+        m_irq->fall(this, &MMA8451Q::irqFired);
+    }
+    // sources latched before we were listening would hold the line low
+    m_pending = 1;
+}
+
+void MMA8451Q::irqFired() {
+    m_pending = 1;
+}
+
+int MMA8451Q::serviceEvents() {
+    int events = 0;
+    uint8_t src, status;
+
+    if (!m_pending)
+        return 0;
+    m_pending = 0;
+
+    readRegs(REG_INT_SOURCE, &src, 1);
+    if (src & SRC_PULSE) {
+        readRegs(REG_PULSE_SRC, &status, 1);
+        if (status & PULSE_SRC_EA)
+            events |= (status & PULSE_SRC_DPE) ? EVENT_DOUBLE_TAP : EVENT_TAP;
+    }
+    if (src & SRC_TRANS) {
+        readRegs(REG_TRANSIENT_SRC, &status, 1);
+        if (status & TRANSIENT_SRC_EA)
+            events |= EVENT_SHAKE;
+    }
+    if (src & SRC_LNDPRT) {
+        readRegs(REG_PL_STATUS, &status, 1);
+        m_orientation = (status >> 1) & 0x03;
+        if (status & PL_STATUS_NEWLP)
+            events |= EVENT_ORIENTATION;
+    }
+
+    // a source that latched while we were reading keeps the line asserted
+    // without producing another falling edge
+    if (m_irq != NULL && m_irq->read() == 0)
+        m_pending = 1;
+
+    if (events && m_handler != NULL)
+        m_handler(events);
+    return events;
+}
+
+int MMA8451Q::getOrientation() {
+    return m_orientation;
+}
+
+void MMA8451Q::standby() {
+    uint8_t ctrl;
+    readRegs(REG_CTRL_REG_1, &ctrl, 1);
+    writeReg(REG_CTRL_REG_1, ctrl & ~CTRL_REG_1_ACTIVE);
+}
+
+void MMA8451Q::activate() {
+    uint8_t ctrl;
+    readRegs(REG_CTRL_REG_1, &ctrl, 1);
+    writeReg(REG_CTRL_REG_1, ctrl | CTRL_REG_1_ACTIVE);
+}
+
+void MMA8451Q::writeReg(uint8_t addr, uint8_t value) {
+    uint8_t data[2] = {addr, value};
+    writeRegs(data, 2);
+}
+
+void MMA8451Q::getAccAllAxisRaw(int16_t * res) {
+    uint8_t data[6];
+    readRegs(REG_OUT_X_MSB, data, 6);
+
+    for (int i = 0; i < 3; i++) {
+        res[i] = toAcc(&data[2*i]);
+    }
+}
+
 int16_t MMA8451Q::getAccAxis(uint8_t addr) {
-    int16_t acc;
     uint8_t res[2];
     readRegs(addr, res, 2);
 
+    return toAcc(res);
+}
+
+int16_t MMA8451Q::toAcc(const uint8_t * res) {
+    int16_t acc;
+
     acc = (res[0] << 6) | (res[1] >> 2);
     if (acc > UINT14_MAX/2)
         acc -= UINT14_MAX;
@@ -71,11 +280,19 @@ int16_t MMA8451Q::getAccAxis(uint8_t addr) {
 }
 
 void MMA8451Q::readRegs(int addr, uint8_t * data, int len) {
+    if (m_queue != NULL) {
+        m_queue->read(m_addr, addr, data, len);
+        return;
+    }
     char t[1] = {addr};
     m_i2c.write(m_addr, t, 1, true);
     m_i2c.read(m_addr, (char *)data, len);
 }
 
 void MMA8451Q::writeRegs(uint8_t * data, int len) {
+    if (m_queue != NULL) {
+        m_queue->write(m_addr, data[0], &data[1], len - 1);
+        return;
+    }
     m_i2c.write(m_addr, (char *)data, len);
 }
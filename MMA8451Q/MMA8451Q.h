@@ -20,6 +20,7 @@
 #define MMA8451Q_H
 
 #include "mbed.h"
+#include "I2CQueue.h"
 
 /**
 * MMA8451Q accelerometer example
@@ -45,10 +46,41 @@
 *     }
 * }
 * @endcode
+*
+* The embedded tap, transient and orientation engines can report through
+* one of the sensor's interrupt lines instead of being polled:
+*
+* @code
+* void onGesture(int events) {
+*     if (events & MMA8451Q::EVENT_DOUBLE_TAP) led = !led;
+* }
+*
+* acc.enableTapDetection(0x20, 0x30, 0xA0, 0xF0);
+* acc.attachEvents(PTC13, &onGesture);
+* while (true) {
+*     acc.serviceEvents();   // no I2C traffic unless the line fired
+* }
+* @endcode
 */
 class MMA8451Q
 {
 public:
+  /** Event bits passed to the handler given to attachEvents() */
+  enum {
+    EVENT_TAP         = 0x01,
+    EVENT_DOUBLE_TAP  = 0x02,
+    EVENT_SHAKE       = 0x04,
+    EVENT_ORIENTATION = 0x08
+  };
+
+  /** Orientation values returned by getOrientation() */
+  enum {
+    PORTRAIT_UP     = 0,
+    PORTRAIT_DOWN   = 1,
+    LANDSCAPE_RIGHT = 2,
+    LANDSCAPE_LEFT  = 3
+  };
+
   /**
   * MMA8451Q constructor
   *
@@ -98,12 +130,115 @@ public:
    */
   void getAccAllAxis(float * res);
 
+  /**
+   * Get XYZ axis acceleration in raw counts (4096 counts = 1g)
+   *
+   * All three axes are fetched in a single burst read.
+   *
+   * @param res array where the three 14-bit samples will be stored
+   */
+  void getAccAllAxisRaw(int16_t * res);
+
+  /**
+   * Move all register traffic onto a shared, interrupt driven queue
+   *
+   * Blocking calls still block, but wait their turn behind queued
+   * transfers instead of fighting them for the bus.
+   *
+   * @param queue queue driving the sensor's bus (e.g. I2CQueueK64F)
+   */
+  void setQueue(I2CQueue *queue);
+
+  /**
+   * Start fetching a new XYZ sample in the background
+   *
+   * Needs setQueue(). The sample becomes available through
+   * getLatchedAccAllAxisRaw() once the transfer completes.
+   *
+   * @returns 0 if the read was queued, -1 if it was not
+   */
+  int requestAccAllAxis();
+
+  /**
+   * Get the last sample fetched by requestAccAllAxis()
+   *
+   * @param res array where the three raw samples will be stored
+   * @returns 1 if the sample is new since the last call, 0 otherwise
+   */
+  int getLatchedAccAllAxisRaw(int16_t * res);
+
+  /**
+   * Enable single and double tap detection on all axes
+   *
+   * @param threshold tap threshold, 0.063g/LSB
+   * @param timeLimit max pulse width, 0.625ms/LSB at 800Hz
+   * @param latency dead time after a tap, 1.25ms/LSB at 800Hz
+   * @param window time for the second tap of a double tap, 1.25ms/LSB at 800Hz
+   */
+  void enableTapDetection(uint8_t threshold, uint8_t timeLimit, uint8_t latency, uint8_t window);
+
+  /**
+   * Enable shake detection through the high-pass filtered transient engine
+   *
+   * @param threshold transient threshold, 0.063g/LSB
+   * @param debounce samples the threshold must be exceeded for
+   */
+  void enableShakeDetection(uint8_t threshold, uint8_t debounce);
+
+  /**
+   * Enable portrait/landscape change detection
+   *
+   * @param debounce samples the new orientation must be held for
+   */
+  void enableOrientationDetection(uint8_t debounce);
+
+  /**
+   * Route the enabled engines to INT2 and report them to handler
+   *
+   * @param irq pin wired to the sensor INT2 line (active low)
+   * @param handler called from serviceEvents() with a mask of EVENT_* bits
+   */
+  void attachEvents(PinName irq, void (*handler)(int events));
+
+  /**
+   * Read and clear the pending event sources, then call the handler
+   *
+   * Call this from the main loop. It returns immediately without touching
+   * the bus when the interrupt line has not fired.
+   *
+   * @returns mask of EVENT_* bits that were dispatched
+   */
+  int serviceEvents();
+
+  /**
+   * Get the last orientation latched by the portrait/landscape engine
+   *
+   * @returns PORTRAIT_UP, PORTRAIT_DOWN, LANDSCAPE_RIGHT or LANDSCAPE_LEFT
+   */
+  int getOrientation();
+
 private:
   I2C m_i2c;
   int m_addr;
+  InterruptIn *m_irq;
+  void (*m_handler)(int events);
+  volatile int m_pending;
+  uint8_t m_intEnable;
+  int m_orientation;
+  I2CQueue *m_queue;
+  uint8_t m_sample[6];
+  int16_t m_latched[3];
+  volatile int m_sampleInFlight;
+  volatile int m_sampleNew;
+  static void sampleDone(void *context, int status);
+  void irqFired();
+  void standby();
+  void activate();
+  void writeReg(uint8_t addr, uint8_t value);
   void readRegs(int addr, uint8_t * data, int len);
   void writeRegs(uint8_t * data, int len);
   int16_t getAccAxis(uint8_t addr);
+  static int16_t toAcc(const uint8_t * res);
 
 };
 
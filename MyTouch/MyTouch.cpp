@@ -2,11 +2,29 @@
 #include "MyTouch.h"
 
 MYTOUCH::MYTOUCH(PinName _tp_mosi, PinName _tp_miso, PinName _tp_sclk, PinName _tp_cs, PinName _tp_irq, unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void))
-        :tp_spi(_tp_mosi,_tp_miso,_tp_sclk),tp_cs(_tp_cs),tp_irqhandler(_tp_irq)
+        :tp_own_spi(new SPIBus(_tp_mosi,_tp_miso,_tp_sclk)),tp_spi(*tp_own_spi),tp_cs(_tp_cs),tp_irqhandler(_tp_irq)
+        {
+        TP_Init(_resolution, pointer_To_TP_IRQ_Handler) ;
+        }
+
+MYTOUCH::MYTOUCH(SPIBus &_bus, PinName _tp_cs, PinName _tp_irq, unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void))
+        :tp_own_spi(NULL),tp_spi(_bus),tp_cs(_tp_cs),tp_irqhandler(_tp_irq)
+        {
+        TP_Init(_resolution, pointer_To_TP_IRQ_Handler) ;
+        }
+
+MYTOUCH::~MYTOUCH()
+        {
+        delete tp_own_spi ;
+        }
+
+void MYTOUCH::TP_Init(unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void))
         {
         tp_cs = 1 ;
-        tp_spi.frequency(TP_FREQUENCY) ;
-        tp_spi.format(8,0) ;
+        tp_dev.cs = &tp_cs ;
+        tp_dev.bits = 8 ;
+        tp_dev.mode = 0 ;
+        tp_dev.hz = TP_FREQUENCY ;
         
         argument_type[0] = TP_GETX_12BIT ;
         argument_type[1] = TP_GETY_12BIT ;
@@ -17,6 +35,8 @@ MYTOUCH::MYTOUCH(PinName _tp_mosi, PinName _tp_miso, PinName _tp_sclk, PinName _
         tp_irqhandler.fall(pointer_To_TP_IRQ_Handler) ;
         
         tp_mode = _resolution ;
+        tp_threshold = TP_PRESSURE_THRESHOLD ;
+        TP_SetCalibration(0, 4095, 0, 4095, 320, 240) ;
         }
         
 unsigned int MYTOUCH::TP_Get(unsigned char XY)
@@ -25,7 +45,7 @@ unsigned int MYTOUCH::TP_Get(unsigned char XY)
     unsigned int tmp;
  
     tmp=0;
-    tp_cs.write(0);
+    tp_spi.select(&tp_dev);
     wait_us(1);
     tp_spi.write(argument_type[tp_mode+XY]);
     wait_us(1);
@@ -42,3 +62,90 @@ unsigned int MYTOUCH::TP_Get(unsigned char XY)
     tmp /= 4;                  // between 0 and 1024
     return tmp;
     }
+
+
+void MYTOUCH::TP_SetCalibration(int _xmin, int _xmax, int _ymin, int _ymax, int _width, int _height)
+    {
+    cal_xmin = _xmin ;
+    cal_xmax = _xmax ;
+    cal_ymin = _ymin ;
+    cal_ymax = _ymax ;
+    cal_width = _width ;
+    cal_height = _height ;
+    }
+
+// Clock out one 12-bit result while shifting in the next command byte,
+// so back to back conversions cost 16 clocks instead of 24.
+unsigned int MYTOUCH::TP_Transfer(unsigned char next_command)
+    {
+    unsigned char hi, low;
+    hi = tp_spi.write(0x00);
+    low = tp_spi.write(next_command);
+    return (((hi << 8) | low) >> 3) & 0xfff;
+    }
+
+static unsigned int tp_median(unsigned int *v, int n)
+    {
+    // insertion sort, n is at most TP_MAX_SAMPLES
+    for (int i = 1; i < n; i++)
+        {
+        unsigned int key = v[i];
+        int j = i - 1;
+        while (j >= 0 && v[j] > key)
+            {
+            v[j+1] = v[j];
+            j--;
+            }
+        v[j+1] = key;
+        }
+    return v[n/2];
+    }
+
+int MYTOUCH::TP_GetRawPoint(int *_x, int *_y, int _samples)
+    {
+    unsigned int xs[TP_MAX_SAMPLES], ys[TP_MAX_SAMPLES];
+    unsigned int z1, z2;
+    int i;
+
+    if (_samples < 1) _samples = 1;
+    if (_samples > TP_MAX_SAMPLES) _samples = TP_MAX_SAMPLES;
+
+    tp_spi.select(&tp_dev);
+    tp_spi.write(TP_GETZ1_12BIT);
+    z1 = TP_Transfer(TP_GETZ2_12BIT);
+    z2 = TP_Transfer(argument_type[USE_12BITS+TP_X]);
+    if (z1 + 4095 - z2 < tp_threshold)
+        {
+        TP_Transfer(0x00);   // drain the X conversion; the panel is not pressed
+        tp_cs.write(1);
+        return 0;
+        }
+    for (i = 0; i < _samples; i++)
+        {
+        xs[i] = TP_Transfer(argument_type[USE_12BITS+TP_Y]);
+        // the last command byte has the start bit clear, so nothing new starts
+        ys[i] = TP_Transfer((i+1 < _samples) ? argument_type[USE_12BITS+TP_X] : 0x00);
+        }
+    tp_cs.write(1);
+
+    *_x = tp_median(xs, _samples);
+    *_y = tp_median(ys, _samples);
+    return 1;
+    }
+
+int MYTOUCH::TP_GetPoint(int *_x, int *_y, int _samples)
+    {
+    int sx, sy;
+
+    if (!TP_GetRawPoint(&sx, &sy, _samples))
+        return 0;
+    sx = (sx - cal_xmin) * cal_width / (cal_xmax - cal_xmin);
+    sy = (sy - cal_ymin) * cal_height / (cal_ymax - cal_ymin);
+    if (sx < 0) sx = 0;
+    if (sx > cal_width - 1) sx = cal_width - 1;
+    if (sy < 0) sy = 0;
+    if (sy > cal_height - 1) sy = cal_height - 1;
+    *_x = sx;
+    *_y = sy;
+    return 1;
+    }
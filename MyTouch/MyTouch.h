@@ -7,6 +7,7 @@
 #define MyTOUCH_H
 
 #include "mbed.h"
+#include "SPIBus.h"
 
 #define USE_12BITS  0
 #define USE_8BITS   2
@@ -15,27 +16,51 @@
 #define     TP_GETY_8BIT     0xD8
 #define     TP_GETX_12BIT    0x90
 #define     TP_GETY_12BIT    0xD0
+#define     TP_GETZ1_12BIT   0xB0
+#define     TP_GETZ2_12BIT   0xC0
 
 #define TP_X 0
 #define TP_Y 1
 
 #define TP_FREQUENCY 500000
 
+#define TP_MAX_SAMPLES          9     // per axis, for TP_GetPoint
+#define TP_PRESSURE_THRESHOLD   300   // Z1 + 4095 - Z2 below this is no touch
+
 class MYTOUCH
     {
     public:
         MYTOUCH(PinName _tp_mosi, PinName _tp_miso, PinName _tp_sclk, PinName _tp_cs, PinName _tp_irq, unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void)) ;
+        // Same, on a bus shared with the display (see SPIBus)
+        MYTOUCH(SPIBus &_bus, PinName _tp_cs, PinName _tp_irq, unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void)) ;
+        ~MYTOUCH() ;
         unsigned int TP_GetX(){return TP_Get(TP_X);}
         unsigned int TP_GetY(){return TP_Get(TP_Y);}
         void TP_ChangeMode(unsigned char _tp_mode){tp_mode = _tp_mode ;}
+        // Batched acquisition: pressure plus _samples X/Y conversions in one
+        // CS-low burst, median filtered and mapped to screen pixels.
+        // Returns 0 (and leaves *_x, *_y alone) when the panel is not pressed.
+        int TP_GetPoint(int *_x, int *_y, int _samples) ;
+        // Same acquisition, but returns the filtered raw 12-bit readings
+        // (for an external calibration such as Labyrinth's TouchCal)
+        int TP_GetRawPoint(int *_x, int *_y, int _samples) ;
+        // Raw 12-bit readings that map to the screen edges, and the screen size
+        void TP_SetCalibration(int _xmin, int _xmax, int _ymin, int _ymax, int _width, int _height) ;
+        void TP_SetPressureThreshold(unsigned int _threshold){tp_threshold = _threshold ;}
     protected:
         unsigned int TP_Get(unsigned char XY) ;
+        unsigned int TP_Transfer(unsigned char next_command) ;
+        void TP_Init(unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void)) ;
     
         unsigned char tp_mode ;
-        SPI tp_spi ;
+        SPIBus *tp_own_spi ;   // only set when the panel made its own bus
+        SPIBus &tp_spi ;
         DigitalOut tp_cs ;
+        SPIBusDevice tp_dev ;
         InterruptIn tp_irqhandler ;
         unsigned char argument_type[4] ;
+        unsigned int tp_threshold ;
+        int cal_xmin, cal_xmax, cal_ymin, cal_ymax, cal_width, cal_height ;
     } ;
 
 #endif
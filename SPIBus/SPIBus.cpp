@@ -0,0 +1,41 @@
+/* SPIBus - one SPI peripheral shared by several chip-selected devices
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include "SPIBus.h"
+
+// the cached settings start out as the mbed SPI defaults (8 bit, mode 0, 1 MHz)
+SPIBus::SPIBus(PinName mosi, PinName miso, PinName sclk) :
+        reconfigurations(0), bytes(0), m_spi(mosi, miso, sclk), m_bits(8), m_mode(0), m_hz(1000000) { }
+
+void SPIBus::format(int bits, int mode)
+{
+    if (bits != m_bits || mode != m_mode) {
+        m_bits = bits ;
+        m_mode = mode ;
+        m_spi.format(bits, mode) ;
+        reconfigurations++ ;
+    }
+}
+
+void SPIBus::frequency(int hz)
+{
+    if (hz != m_hz) {
+        m_hz = hz ;
+        m_spi.frequency(hz) ;
+        reconfigurations++ ;
+    }
+}
+
+void SPIBus::select(SPIBusDevice *dev)
+{
+    format(dev->bits, dev->mode) ;
+    frequency(dev->hz) ;
+    *dev->cs = 0 ;
+}
@@ -0,0 +1,87 @@
+/* SPIBus - one SPI peripheral shared by several chip-selected devices
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+ /*
+  * Note: the TFT, the XPT2046 and the STMPE610 on the shield all use the
+  * same MOSI/MISO/SCLK pins with different formats and clocks. With one
+  * SPI object per driver the peripheral was reprogrammed on every access;
+  * with one SPIBus shared by the drivers it is only reprogrammed when the
+  * format or clock actually changes.
+  */
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+#include "mbed.h"
+
+/** A device on the bus: its chip select and the settings it needs */
+typedef struct {
+    DigitalOut *cs ;
+    int bits ;
+    int mode ;
+    int hz ;
+} SPIBusDevice ;
+
+/** SPI bus arbiter
+ *
+ * A transaction starts with select(), which applies the device settings
+ * and pulls its chip select low in one step, and ends when the driver
+ * raises the chip select again. There is no locking: transactions are
+ * only started from the main loop, and interrupt handlers leave their
+ * bus work to it, so one never starts in the middle of another.
+ *
+ * Example:
+ * @code
+ * SPIBus bus(PTD2, PTD3, PTD1) ;
+ * SPI_TFT_ILI9341 TFT(bus, PTD0, PTC3, PTD5) ;
+ * MYTOUCH touch(bus, PTA0, PTC13, USE_12BITS, NULL) ;
+ * @endcode
+ */
+class SPIBus
+{
+public:
+    /** Create the bus
+     *
+     * @param mosi SPI_MOSI pin
+     * @param miso SPI_MISO pin
+     * @param sclk SPI_CLK pin
+     */
+    SPIBus(PinName mosi, PinName miso, PinName sclk) ;
+
+    /** Set the frame format, if it differs from the current one */
+    void format(int bits, int mode = 0) ;
+
+    /** Set the clock, if it differs from the current one */
+    void frequency(int hz = 1000000) ;
+
+    /** Write one frame and return the frame clocked in */
+    int write(int value) {
+        bytes += m_bits > 8 ? 2 : 1 ;
+        return( m_spi.write(value) ) ;
+    }
+
+    /** Start a transaction for dev
+     *
+     * Applies the settings of dev and pulls its chip select low. The
+     * caller raises it when done.
+     */
+    void select(SPIBusDevice *dev) ;
+
+    /** Format and clock changes actually written to the peripheral */
+    unsigned int reconfigurations ;
+
+    /** Bytes clocked out, for comparing the traffic of two builds */
+    unsigned int bytes ;
+
+private:
+    SPI m_spi ;
+    int m_bits, m_mode, m_hz ;
+} ;
+
+#endif
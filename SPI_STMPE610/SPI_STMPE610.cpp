@@ -32,6 +32,7 @@
 
 #define REG_SYS_CTRL2     0x04
 #define REG_SPI_CFG       0x08
+#define REG_SPI_CFG_AUTO_INCR 0x04
 #define REG_INT_CTRL      0x09
 #define REG_INT_CTRL_POL_HIGH 0x04
 #define REG_INT_CTRL_POL_LOW  0x00
@@ -123,39 +124,56 @@
 #define REG_TSC_SHIELD    0x59
 
 SPI_STMPE610::SPI_STMPE610(PinName mosi, PinName miso, PinName sclk, PinName cs) :
-        m_spi(mosi, miso, sclk), m_cs(cs) {
+        m_own_spi(new SPIBus(mosi, miso, sclk)), m_spi(*m_own_spi), m_cs(cs) {
+    init() ;
+}
+
+SPI_STMPE610::SPI_STMPE610(SPIBus &bus, PinName cs) :
+        m_own_spi(NULL), m_spi(bus), m_cs(cs) {
+    init() ;
+}
+
+void SPI_STMPE610::init(void) {
     // activate the peripheral
-    m_cs = 0 ;
+    m_cs = 1 ;
     _mode = 0 ;
-    m_spi.frequency(1000000) ;
-    m_spi.format(8, 0) ;
+    m_dev.cs = &m_cs ;
+    m_dev.bits = 8 ;
+    m_dev.mode = 0 ;
+    m_dev.hz = 1000000 ;
     write8(REG_SYS_CTRL1, REG_SYS_CTRL1_RESET) ;
     wait(0.1) ;
     write8(REG_SYS_CTRL2, 0x00) ; // turn on clocks
+    write8(REG_SPI_CFG, read8(REG_SPI_CFG) | REG_SPI_CFG_AUTO_INCR) ;
     write8(REG_TSC_CFG,
           REG_TSC_CFG_4SAMPLE 
         | REG_TSC_CFG_DELAY_100US
         | REG_TSC_CFG_SETTLE_1MS ) ;
         
     write8(REG_TSC_CTRL, REG_TSC_CTRL_XYZ | REG_TSC_CTRL_EN) ;   
-    m_cs = 1 ;
 }
 
-SPI_STMPE610::~SPI_STMPE610() { }
+SPI_STMPE610::~SPI_STMPE610() {
+    delete m_own_spi ;
+}
 
 void SPI_STMPE610::readRegs(int addr, uint8_t * data, int len) {
-    m_cs = 0 ;
-
-    for (int i = 0 ; i < len ; i++ ) {    
-       m_spi.write((addr+i)|0x80) ;  // spacify address to read
-       data[i] = m_spi.write((addr+i)|0x80) ; 
-    } 
-    m_spi.write(0x00) ; // to terminate read mode
+    if (len <= 0) {
+        return ;
+    }
+    m_spi.select(&m_dev) ;
+    m_spi.write(addr | 0x80) ;  // specify address to read
+    // each byte clocked in carries the next address out, so the
+    // burst costs len + 1 transfers instead of 2 * len + 1
+    for (int i = 0 ; i < len - 1 ; i++ ) {
+       data[i] = m_spi.write((addr + i + 1) | 0x80) ;
+    }
+    data[len - 1] = m_spi.write(0x00) ; // to terminate read mode
     m_cs = 1 ;
 }
 
 void SPI_STMPE610::writeRegs(uint8_t * data, int len) {
-   m_cs = 0 ;
+   m_spi.select(&m_dev) ;
    for (int i = 0 ; i < len ; i++ ) {
       m_spi.write(data[i]) ;
    }
@@ -23,6 +23,7 @@
 #define SPI_STMPE610_H
 
 #include "mbed.h"
+#include "SPIBus.h"
 
 
 /** SPI_STMPE610 Touch Sensor
@@ -67,6 +68,15 @@ public:
  */
  
  SPI_STMPE610(PinName mosi, PinName miso, PinName sclk, PinName cs) ;
+
+ /**
+ * STMPE610 constructor for a bus shared with the display
+ *
+ * @param bus  SPI bus, see SPIBus
+ * @param cs   SPI_CS  pin
+ */
+ 
+ SPI_STMPE610(SPIBus &bus, PinName cs) ;
  
  /** 
   * Destructor 
@@ -77,8 +87,10 @@ public:
   * some member functions here (yet to be written)
   */
 
- SPI m_spi;
+ SPIBus *m_own_spi ;   // only set when the sensor made its own bus
+ SPIBus &m_spi;
  DigitalOut m_cs ;
+ SPIBusDevice m_dev ;
  int _mode ;
  
   void readRegs(int addr, uint8_t *data, int len) ;
@@ -100,6 +112,7 @@ public:
   int getRAWPoint(uint16_t *x, uint16_t *y, uint16_t *z) ;
   
   private:
+  void init(void) ;
 } ;
 
 #endif /* SPI_STMPE610_H */
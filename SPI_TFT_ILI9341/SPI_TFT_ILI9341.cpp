@@ -25,14 +25,30 @@
 //extern DigitalOut xx;     // debug !!
 
 SPI_TFT_ILI9341::SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName reset, PinName dc, const char *name)
-    : GraphicsDisplay(name), _spi(mosi, miso, sclk), _cs(cs), _dc(dc)
+    : GraphicsDisplay(name), _own_spi(new SPIBus(mosi, miso, sclk)), _spi(*_own_spi), _cs(cs), _dc(dc)
 {
     orientation = 0;
     char_x = 0;
+    _win_x0 = -1;
     _reset = reset;
     tft_reset();
 }
 
+SPI_TFT_ILI9341::SPI_TFT_ILI9341(SPIBus& bus, PinName cs, PinName reset, PinName dc, const char *name)
+    : GraphicsDisplay(name), _own_spi(NULL), _spi(bus), _cs(cs), _dc(dc)
+{
+    orientation = 0;
+    char_x = 0;
+    _win_x0 = -1;
+    _reset = reset;
+    tft_reset();
+}
+
+SPI_TFT_ILI9341::~SPI_TFT_ILI9341()
+{
+    delete _own_spi;
+}
+
 int SPI_TFT_ILI9341::width()
 {
     if (orientation == 0 || orientation == 2) return 240;
@@ -70,12 +86,18 @@ void SPI_TFT_ILI9341::set_orientation(unsigned int o)
 } 
 
 
+unsigned int SPI_TFT_ILI9341::get_orientation()
+{
+    return orientation;
+}
+
+
 // write command to tft register
 
 void SPI_TFT_ILI9341::wr_cmd(unsigned char cmd)
 {
     _dc = 0;
-    _cs = 0;
+    _spi.select(&_dev);   // 8 bit mode 3, cs low
     _spi.write(cmd);      // mbed lib
     _dc = 1;
 }
@@ -107,9 +129,11 @@ void SPI_TFT_ILI9341::wr_dat(unsigned char dat)
 
 void SPI_TFT_ILI9341::tft_reset()
 {
-    _spi.format(8,3);                  // 8 bit spi mode 3
-  _spi.frequency(10000000);          // 10 Mhz SPI clock
- //   _spi.frequency(1000000) ;
+    _dev.cs = &_cs;
+    _dev.bits = 8;                     // 8 bit spi mode 3
+    _dev.mode = 3;
+    _dev.hz = 10000000;                // 10 Mhz SPI clock
+ //   _dev.hz = 1000000 ;
     _cs = 1;                           // cs high
     _dc = 1;                           // dc high 
     if (_reset != NC)
@@ -270,6 +294,7 @@ void SPI_TFT_ILI9341::tft_reset()
 
 void SPI_TFT_ILI9341::pixel(int x, int y, int color)
 {
+    _win_x0 = -1;                     // only the start addresses are set
     wr_cmd(0x2A);
     _spi.write(x >> 8);
     _spi.write(x);
@@ -293,6 +318,10 @@ void SPI_TFT_ILI9341::pixel(int x, int y, int color)
 
 void SPI_TFT_ILI9341::window (unsigned int x, unsigned int y, unsigned int w, unsigned int h)
 {
+    _win_x0 = x;
+    _win_x1 = x+w-1;
+    _win_y0 = y;
+    _win_y1 = y+h-1;
     wr_cmd(0x2A);
     _spi.write(x >> 8);
     _spi.write(x);
@@ -545,6 +574,46 @@ void SPI_TFT_ILI9341::fillrect(int x0, int y0, int x1, int y1, int color)
 }
 
 
+void SPI_TFT_ILI9341::fillspan(int x0, int y0, int x1, int y1, int color)
+{
+    int pixel = (x1 - x0 + 1) * (y1 - y0 + 1);
+    if (x0 != _win_x0 || x1 != _win_x1) {
+        wr_cmd(0x2A);
+        _spi.write(x0 >> 8);
+        _spi.write(x0);
+        _spi.write(x1 >> 8);
+        _spi.write(x1);
+        _cs = 1;
+        _win_x0 = x0;
+        _win_x1 = x1;
+    }
+    if (y0 != _win_y0 || y1 != _win_y1) {
+        wr_cmd(0x2B);
+        _spi.write(y0 >> 8);
+        _spi.write(y0);
+        _spi.write(y1 >> 8);
+        _spi.write(y1);
+        _cs = 1;
+        _win_y0 = y0;
+        _win_y1 = y1;
+    }
+    wr_cmd(0x2C);  // send pixel
+    #if defined TARGET_KL25Z  // 8 Bit SPI
+    for (int p=0; p<pixel; p++) {
+        _spi.write(color >> 8);
+        _spi.write(color & 0xff);
+    }
+    #else
+    _spi.format(16,3);                            // switch to 16 bit Mode 3
+    for (int p=0; p<pixel; p++) {
+        _spi.write(color);
+    }
+    _spi.format(8,3);
+    #endif
+    _cs = 1;
+}
+
+
 void SPI_TFT_ILI9341::locate(int x, int y)
 {
     char_x = x;
@@ -694,6 +763,33 @@ void SPI_TFT_ILI9341::Bitmap(unsigned int x, unsigned int y, unsigned int w, uns
 }
 
 
+void SPI_TFT_ILI9341::BitmapRLE(unsigned int x, unsigned int y, unsigned int w, unsigned int h, const unsigned char *runs, int n)
+{
+    window(x, y, w, h);
+    wr_cmd(0x2C);  // send pixel
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    _spi.format(16,3);
+    #endif                            // switch to 16 bit Mode 3
+    for (int r = 0; r < n; r++, runs += 4) {
+        unsigned int count = runs[0] | (runs[1] << 8);
+        unsigned short color = runs[2] | (runs[3] << 8);
+        while (count--) {
+            #if defined TARGET_KL25Z  // 8 Bit SPI
+                _spi.write(color >> 8);
+                _spi.write(color & 0xff);
+            #else
+                _spi.write(color);
+            #endif
+        }
+    }
+    _cs = 1;
+    #ifndef TARGET_KL25Z  // 16 Bit SPI
+    _spi.format(8,3);
+    #endif
+    WindowMax();
+}
+
+
 // local filesystem is not implemented in kinetis board
 #if DEVICE_LOCALFILESYSTEM
 
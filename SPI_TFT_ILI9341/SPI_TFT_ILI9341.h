@@ -19,6 +19,7 @@
 
 #include "mbed.h"
 #include "GraphicsDisplay.h"
+#include "SPIBus.h"
 
 #define RGB(r,g,b)  (((r&0xF8)<<8)|((g&0xFC)<<3)|((b&0xF8)>>3)) //5 red | 6 green | 5 blue
 
@@ -92,6 +93,17 @@
    * the IM pins have to be set to 1110 (3-0) 
    */ 
   SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName reset, PinName dc, const char* name ="TFT");
+
+  /** Create a SPI_TFT object on a bus shared with other devices
+   *
+   * @param bus SPI bus, see SPIBus
+   * @param cs pin connected to CS of display
+   * @param reset pin connected to RESET of display
+   * @param dc pin connected to WR of display
+   */ 
+  SPI_TFT_ILI9341(SPIBus& bus, PinName cs, PinName reset, PinName dc, const char* name ="TFT");
+
+  ~SPI_TFT_ILI9341();
     
   /** Get the width of the screen in pixel
    *
@@ -158,6 +170,18 @@
    * @param color 16 bit color
    */    
   void fillrect(int x0, int y0, int x1, int y1, int colour);
+
+  /** Fill a small rect, for many small updates in a row
+   *
+   * Unlike fillrect() the window is left as it is afterwards, and only
+   * the column or page range that differs from the current window is
+   * sent, so a run of short spans costs a few bytes of setup each.
+   *
+   * @param x0,y0 top left corner
+   * @param x1,y1 down right corner
+   * @param color 16 bit color
+   */
+  void fillspan(int x0, int y0, int x1, int y1, int colour);
     
   /** Setup cursor position
    *
@@ -216,6 +240,19 @@
    * tft.Bitmap(10,40,309,50,(unsigned char *)scala);
    */    
   void Bitmap(unsigned int x, unsigned int y, unsigned int w, unsigned int h,unsigned char *bitmap);
+
+  /** Paint a run-length encoded image on the TFT in one window
+   *
+   * @param x,y : upper left corner
+   * @param w width of the image
+   * @param h height of the image
+   * @param runs pointer to the runs
+   * @param n number of runs
+   *
+   * each run is 4 bytes: pixel count and 16 bit R5 G6 B5 colour, both
+   * little-endian. Runs fill the window row by row and may cross rows.
+   */
+  void BitmapRLE(unsigned int x, unsigned int y, unsigned int w, unsigned int h, const unsigned char *runs, int n);
     
 #if DEVICE_LOCALFILESYSTEM
    /** Paint a 16 bit BMP from local filesytem on the TFT (slow) 
@@ -258,9 +295,18 @@
    * @param o direction to use the screen (0-3)  
    */  
   void set_orientation(unsigned int o);
+
+  /** Get the orientation set with set_orientation
+   *
+   * @returns direction the screen is used in (0-3)
+   */  
+  unsigned int get_orientation();
     
-  SPI _spi;
+  SPIBus* _own_spi;                  // only set when the display made its own bus
+  SPIBus& _spi;
   DigitalOut _cs; 
+  SPIBusDevice _dev;
+  int _win_x0, _win_x1, _win_y0, _win_y1;  // current window, _win_x0 < 0 if unknown
   PinName _reset;
   DigitalOut _dc;
   unsigned char* font;
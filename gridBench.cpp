@@ -0,0 +1,198 @@
+/* Labyrinth spatial index benchmark
+ *
+ * Fills a 320x240 level with a few hundred random walls and holes and
+ * times the lookups the game does every frame, once by scanning every
+ * item and once through the grid, and "does the marble touch a wall
+ * here?" also against the occupancy bitmap (Occupancy.h). Then times
+ * the physics step both ways. Results go to the USB serial port.
+ *
+ * Build this instead of mainMain.cpp (it has its own main()).
+ */
+
+#include "mbed.h"
+#include "Grid.h"
+#include "Occupancy.h"
+#include "Physics.h"
+
+#define BENCH_WIDTH    320
+#define BENCH_HEIGHT   240
+#define BENCH_WALLS    300
+#define BENCH_HOLES    200
+#define BENCH_QUERIES  2000
+#define BENCH_RADIUS   5
+
+static Grid grid;
+static Occupancy occ;
+static PhysBox walls[BENCH_WALLS];
+static int queryX[BENCH_QUERIES];
+static int queryY[BENCH_QUERIES];
+
+/* What the game did before the grid: test every item */
+static int linearQuery(int x0, int y0, int x1, int y1, int mask)
+{
+	int n = 0;
+	for (int i = 0; i < grid.numItems; i++) {
+		const GridItem *it = &grid.items[i];
+		if ((it->kind & mask) && it->x0 <= x1 && it->x1 >= x0 && it->y0 <= y1 && it->y1 >= y0) {
+			n++;
+		}
+	}
+	return n;
+}
+
+static void buildLevel()
+{
+	gridInit(&grid, BENCH_WIDTH, BENCH_HEIGHT);
+	for (int i = 0; i < BENCH_WALLS; i++) {
+		// thin horizontal or vertical segments like the maze walls
+		int len = 8 + rand() % 40;
+		walls[i].x = rand() % BENCH_WIDTH;
+		walls[i].y = rand() % BENCH_HEIGHT;
+		walls[i].w = (i & 1) ? len : 4;
+		walls[i].h = (i & 1) ? 4 : len;
+		gridAddBox(&grid, GRID_WALL, i, walls[i].x, walls[i].y, walls[i].w, walls[i].h);
+	}
+	for (int i = 0; i < BENCH_HOLES; i++) {
+		gridAddCircle(&grid, GRID_HOLE, i, rand() % BENCH_WIDTH, rand() % BENCH_HEIGHT, BENCH_RADIUS);
+	}
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		queryX[i] = rand() % BENCH_WIDTH;
+		queryY[i] = rand() % BENCH_HEIGHT;
+	}
+}
+
+static void benchQueries(int mask, const char *name)
+{
+	Timer t;
+	uint16_t hits[64];
+	int linearHits = 0, gridHits = 0;
+	int r = BENCH_RADIUS + 1;
+
+	t.start();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		linearHits += linearQuery(queryX[i] - r, queryY[i] - r, queryX[i] + r, queryY[i] + r, mask);
+	}
+	int linearUs = t.read_us();
+
+	t.reset();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		gridHits += gridQuery(&grid, queryX[i] - r, queryY[i] - r, queryX[i] + r, queryY[i] + r, mask, hits, 64);
+	}
+	int gridUs = t.read_us();
+
+	printf("%-12s linear %5d us  grid %5d us  (%d queries, hits %d/%d)\r\n",
+	       name, linearUs, gridUs, BENCH_QUERIES, linearHits, gridHits);
+}
+
+/* What checkWalls() did: every wall, as a box grown by the radius */
+static int scanTouch(int x, int y, int r)
+{
+	for (int i = 0; i < BENCH_WALLS; i++) {
+		const PhysBox *b = &walls[i];
+		if (x >= b->x - r && x <= b->x + b->w + r && y >= b->y - r && y <= b->y + b->h + r) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int gridTouch(int x, int y, int r)
+{
+	uint16_t hits[64];
+	return gridQuery(&grid, x - r, y - r, x + r, y + r, GRID_WALL, hits, 64) > 0;
+}
+
+static void benchTouch()
+{
+	Timer t;
+	int scanHits = 0, gridHits = 0, occHits = 0;
+	int r = BENCH_RADIUS;
+
+	t.start();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		scanHits += scanTouch(queryX[i], queryY[i], r);
+	}
+	int scanUs = t.read_us();
+
+	t.reset();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		gridHits += gridTouch(queryX[i], queryY[i], r);
+	}
+	int gridUs = t.read_us();
+
+	t.reset();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		occHits += occTestDisc(&occ, queryX[i], queryY[i], r);
+	}
+	int occUs = t.read_us();
+
+	// the boxes count the corners the disc doesn't reach, so they find more
+	printf("%-12s linear %5d us  grid %5d us  bitmap %5d us  (%d queries, hits %d/%d/%d)\r\n",
+	       "touch", scanUs, gridUs, occUs, BENCH_QUERIES, scanHits, gridHits, occHits);
+}
+
+static int runSteps(Physics *physics)
+{
+	Marble marble;
+	Timer t;
+
+	marbleInit(&marble, BENCH_WIDTH / 2, BENCH_HEIGHT / 2, BENCH_RADIUS);
+	t.start();
+	for (int i = 0; i < BENCH_QUERIES; i++) {
+		physicsStep(physics, &marble);
+	}
+	return t.read_us();
+}
+
+static void benchPhysics()
+{
+	Physics physics;
+
+	physicsInit(&physics, BENCH_WIDTH, BENCH_HEIGHT);
+	physicsSetWalls(&physics, walls, BENCH_WALLS);
+	physicsSetTilt(&physics, 300, 200, 1000);
+
+	int linearUs = runSteps(&physics);
+	physicsSetGrid(&physics, &grid);
+	int gridUs = runSteps(&physics);
+
+	printf("%-12s linear %5d us  grid %5d us  (%d steps)\r\n",
+	       "physicsStep", linearUs, gridUs, BENCH_QUERIES);
+}
+
+int main()
+{
+	Timer t;
+
+	srand(1);
+	t.start();
+	buildLevel();
+	int addUs = t.read_us();
+	t.reset();
+	int built = gridBuild(&grid);
+	int buildUs = t.read_us();
+
+	printf("\r\ngrid %dx%d cells of %d px, %d items, %d refs, add %d us, build %d us%s\r\n",
+	       grid.cols, grid.rows, 1 << grid.cellShift, grid.numItems, grid.numRefs,
+	       addUs, buildUs, built ? "" : " (too many refs, linear fallback)");
+	printf("memory: %d bytes\r\n", (int)sizeof(grid));
+
+	t.reset();
+	occInit(&occ, BENCH_WIDTH, BENCH_HEIGHT);
+	for (int i = 0; i < BENCH_WALLS; i++) {
+		const PhysBox *b = &walls[i];
+		occFillRect(&occ, b->x, b->y, b->x + b->w, b->y + b->h);
+	}
+	int fillUs = t.read_us();
+	printf("bitmap %dx%d, fill %d us, memory %d bytes\r\n", occ.width, occ.height, fillUs, (int)sizeof(occ));
+
+	benchQueries(GRID_WALL, "walls");
+	benchQueries(GRID_HOLE | GRID_GOAL, "holes/goal");
+	benchQueries(GRID_WALL | GRID_HOLE | GRID_GOAL, "all");
+	benchTouch();
+	benchPhysics();
+
+	while (1) {
+		wait(1);
+	}
+}
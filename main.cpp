@@ -29,6 +29,7 @@
 #include "MMA8451Q.h"
 #include <math.h>
 #include "SPI_TFT_ILI9341.h"
+#include "SPIBus.h"
 #include "SPI_STMPE610.h"
 #include "Arial12x12.h"
 #include "Arial24x23.h"
@@ -82,8 +83,10 @@ MMA8451Q *acc = 0 ;
 
 // SeeedStudioTFTv2 TFT(PIN_XP, PIN_XM, PIN_YP, PIN_YM, PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_DC_TFT, PIN_BL_TFT, PIN_CS_SD);
 //  SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName reset, PinName dc, const char* name ="TFT");
-SPI_TFT_ILI9341 TFT(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
-SPI_STMPE610 TSC(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TSC) ;
+// the display and the touch controller share one SPI bus
+SPIBus spiBus(PIN_MOSI, PIN_MISO, PIN_SCLK) ;
+SPI_TFT_ILI9341 TFT(spiBus, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
+SPI_STMPE610 TSC(spiBus, PIN_CS_TSC) ;
 
 DigitalOut backlight(PIN_BACKLIGHT) ;
 DigitalIn pinD7(PIN_TSC_INTR) ;
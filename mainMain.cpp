@@ -27,8 +27,10 @@
 
 #include "mbed.h"
 #include "MMA8451Q.h"
+#include "I2CQueueK64F.h"
 #include <math.h>
 #include "SPI_TFT_ILI9341.h"
+#include "SPIBus.h"
 //#include "SPI_STMPE610.h"
 #include "Arial12x12.h"
 #include "Arial24x23.h"
@@ -37,8 +39,26 @@
 #include "mbed.h"
 //#include "ssd1289.h"
 #include "MyTouch.h"
+#include "Tilt.h"
+#include "EventQueue.h"
+#include "TouchCal.h"
+#include "Gesture.h"
+#include "Physics.h"
+#include "Grid.h"
+#include "ZoneField.h"
+#include "Occupancy.h"
+#include "FlowField.h"
+#include "Level.h"
+#include "Levels.h"
+#include "MazeGen.h"
+#include "Compositor.h"
+#include "FramePacer.h"
+#include "Tween.h"
+#include "Scene.h"
+#include "Recorder.h"
 
 #include <stdio.h>
+#include <string.h>
 
 #if 1
 // For FRDM-K64F
@@ -59,39 +79,200 @@
 #define PIN_CS_TSC      PTA2
 #define PIN_TSC_INTR    PTC2
 #define PIN_BACKLIGHT   PTA1
+#define PIN_ACC_INT2    PTC13
 #endif
 
 
 #define MMA8451_I2C_ADDRESS (0x1d<<1)
 MMA8451Q *acc = 0 ;
+I2CQueueK64F *i2cQueue = 0 ;
+#define ACC_1G 4096
+Tilt tilt;
 void mytouch_irq_handler(void) ;
 volatile unsigned int xT, yT ;
 
 // SeeedStudioTFTv2 TFT(PIN_XP, PIN_XM, PIN_YP, PIN_YM, PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_DC_TFT, PIN_BL_TFT, PIN_CS_SD);
 //  SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName reset, PinName dc, const char* name ="TFT");
-SPI_TFT_ILI9341 TFT(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
+// the display and the touch controller share one SPI bus
+SPIBus spiBus(PIN_MOSI, PIN_MISO, PIN_SCLK) ;
+SPI_TFT_ILI9341 TFT(spiBus, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
 //SPI_STMPE610 TSC(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TSC) ;
-// mosi, miso, sck, cs, irq pin, mode, pointer to touch panel irq handler
-MYTOUCH MyTouch( PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TSC, PIN_TSC_INTR, USE_12BITS, &mytouch_irq_handler);
+// bus, cs, irq pin, mode, pointer to touch panel irq handler
+MYTOUCH MyTouch(spiBus, PIN_CS_TSC, PIN_TSC_INTR, USE_12BITS, &mytouch_irq_handler);
 
 DigitalIn pinD7(PIN_TSC_INTR) ;
 DigitalOut backlight(PIN_BACKLIGHT) ;
 
-/* Interrupt handler for touch screen */
-int paused = 0;
-int printed = 0;
+/* Interrupt handler for touch screen: only queue the touch, the main
+   loop does the drawing (SPI may be busy with a frame when this fires) */
+EventQueue events;
 void mytouch_irq_handler(void)
 {
-//		paused = 1-paused;
+		eventPost(&events, EVENT_TOUCH, 0, us_ticker_read());
+}
+
+/* Input recording: everything read from the sensors is logged so a run
+   can be dumped (long press) and played back exactly by a build with
+   INPUT_MODE set to INPUT_REPLAY, which reads the dump from the serial
+   port at startup instead of reading the sensors */
+#define INPUT_LIVE      0
+#define INPUT_RECORD    1
+#define INPUT_REPLAY    2
+#define INPUT_MODE      INPUT_RECORD
+#define REC_BUF_SIZE    16384   // ~60 s of play
+int inputMode = INPUT_MODE;
+uint8_t recBuf[REC_BUF_SIZE];
+Recorder recorder;
+Replay replay;
+void dumpRecording(void) ;
+void reportFrames(void) ;
+void reportHint(void) ;
+
+int paused = 0;
+void togglePause(void)
+{
 		paused = 1-paused;
-		if (paused && !printed) {
-			wait(0.5);
-			TFT.locate(TFT.width()/2-10, TFT.height()/2);
-//			TFT.printf("||");
-			printed = 1;
+}
+
+/* Hint arrow by the ball, shown and hidden with a swipe */
+int hintOn = 0;
+
+/* Touch gestures: the pen-down interrupt starts tracking, then the panel
+   is sampled once per frame until it is released. A press that is gone
+   by the first sample is contact bounce and never becomes a gesture. */
+TouchCal touchCal;
+GestureRecognizer gestures;
+int touchTracking = 0;
+int touchTapped = 0;
+
+void handleGesture(const Gesture *g)
+{
+	if (g->type == GESTURE_TAP) {
+		touchTapped = 1;
+		togglePause();
+	} else if (g->type == GESTURE_SWIPE) {
+		hintOn = !hintOn;
+	} else if (g->type == GESTURE_LONG_PRESS && inputMode == INPUT_RECORD) {
+		dumpRecording();
+	}
+}
+
+/* Accelerometer gestures, live or replayed */
+void accEvents(int events)
+{
+		if (events & MMA8451Q::EVENT_DOUBLE_TAP) {
+			togglePause();
 		}
-		
-		wait(0.1);
+}
+
+/* Handle everything the interrupt handlers queued since the last frame */
+void dispatchEvents(void)
+{
+	Event ev;
+	Gesture g;
+	int pressed, rx, ry, x = 0, y = 0;
+	while (eventGet(&events, &ev, us_ticker_read())) {
+		if (ev.type == EVENT_TOUCH) {
+			touchTracking = 1;
+		}
+	}
+	if (inputMode == INPUT_REPLAY) {
+		// the panel and the accelerometer taps as they were recorded
+		RecSample s;
+		touchTracking = 0;
+		while (replayTake(&replay, REC_TOUCH, &s)) {
+			if (gestureUpdate(&gestures, s.value, s.x, s.y, s.time, &g)) {
+				handleGesture(&g);
+			}
+		}
+		while (replayTake(&replay, REC_TAP, &s)) {
+			accEvents(s.value);
+		}
+		return;
+	}
+	if (touchTracking) {
+		pressed = MyTouch.TP_GetRawPoint(&rx, &ry, 3);
+		if (pressed) {
+			touchCalMap(&touchCal, rx, ry, &x, &y);
+		}
+		uint32_t now = us_ticker_read();
+		if (inputMode == INPUT_RECORD) {
+			recTouch(&recorder, pressed, x, y, now);
+		}
+		if (gestureUpdate(&gestures, pressed, x, y, now, &g)) {
+			handleGesture(&g);
+		}
+		if (!pressed) {
+			touchTracking = 0;
+		}
+	}
+}
+
+/* Accelerometer gesture handler, called from acc->serviceEvents() */
+void acc_event_handler(int events)
+{
+		if (inputMode == INPUT_REPLAY) {
+			return;
+		} else if (inputMode == INPUT_RECORD) {
+			recTap(&recorder, events);
+		}
+		accEvents(events);
+}
+
+/* Run the latest accelerometer sample through the tilt filter.
+   The sample was fetched in the background while the previous frame
+   was drawn; the next one is started here so it overlaps this frame. */
+void readTilt(void)
+{
+	int16_t raw[3];
+	if (inputMode == INPUT_REPLAY) {
+		RecSample s;
+		if (replayTake(&replay, REC_ACCEL, &s)) {
+			tiltUpdate(&tilt, s.x, s.y);
+		}
+		return;
+	}
+	if (acc->getLatchedAccAllAxisRaw(raw)) {
+		tiltUpdate(&tilt, raw[0], raw[1]);
+		if (inputMode == INPUT_RECORD) {
+			recAccel(&recorder, raw[0], raw[1]);
+		}
+	}
+	acc->requestAccAllAxis();
+}
+
+/* Tilt offsets are kept in the system register file, which survives
+   resets (but not power cycles), so the level is only captured once */
+#define TILT_CAL_MAGIC 0x54494C54
+int loadTiltCalibration(void)
+{
+	if (inputMode == INPUT_REPLAY) {
+		// whatever the recorded run found
+		RecSample s;
+		if (!replayTake(&replay, REC_CAL, &s)) {
+			return 0;
+		}
+		tiltSetOffsets(&tilt, s.x, s.y);
+		return 1;
+	}
+	if (RFSYS->REG[0] != TILT_CAL_MAGIC) {
+		return 0;
+	}
+	uint32_t packed = RFSYS->REG[1];
+	tiltSetOffsets(&tilt, (int16_t)(packed & 0xFFFF), (int16_t)(packed >> 16));
+	if (inputMode == INPUT_RECORD) {
+		recCal(&recorder, tilt.offX, tilt.offY);
+	}
+	return 1;
+}
+
+void saveTiltCalibration(void)
+{
+	if (inputMode == INPUT_REPLAY) {
+		return;
+	}
+	RFSYS->REG[1] = (uint16_t)tilt.offX | ((uint32_t)(uint16_t)tilt.offY << 16);
+	RFSYS->REG[0] = TILT_CAL_MAGIC;
 }
 
 /* Screen initialization */
@@ -211,12 +392,141 @@ typedef struct ball {
 	/**color */
 	int color;
 
-	/* Accelerometer variables; number will be generated from accelerometer 
-	   output and ball will move proportionally */
-	int xAcc;
-	int yAcc;
+	/* Sub-pixel position and velocity; x_pos/y_pos is where it is drawn */
+	Marble body;
 } Ball;
 
+/* Marble physics: runs in fixed steps on its own clock, so the ball
+   rolls at the same speed however long a frame takes */
+Physics physics;
+
+/* Frame pacing: a ticker counts physics steps and the loops render
+   every FRAME_TICKS of them, sleeping in between (see FramePacer.h) */
+#define FRAME_TICKS   2     // 50 Hz
+FramePacer pacer;
+Ticker frameTicker;
+int frameSteps = 0;
+
+/* Animations (see Tween.h), advanced by the frame's ticks */
+Timeline timeline;
+
+void frameTickHandler(void)
+{
+	frameTick(&pacer);
+}
+
+/* End of a frame in any loop: sleep until the next one is due and
+   start it. frameSteps is then the physics steps it owes, and the
+   animations have moved on by as much. */
+void nextFrame(void)
+{
+	frameEnd(&pacer, us_ticker_read());
+	while (!frameDue(&pacer)) {
+		__WFI();
+	}
+	frameSteps = frameBegin(&pacer, us_ticker_read());
+	if (inputMode == INPUT_RECORD) {
+		recFrame(&recorder, frameSteps);
+	} else if (inputMode == INPUT_REPLAY) {
+		// the recorded steps, whatever this build's frames take
+		RecSample s;
+		if (replayTake(&replay, REC_FRAME, &s)) {
+			frameSteps = s.value;
+		} else {
+			printf("replay done, %u frames%s\r\n", replay.frames, replay.bad ? " (corrupt)" : "");
+			reportFrames();
+			inputMode = INPUT_LIVE;
+		}
+	}
+	timelineUpdate(&timeline, frameSteps * PHYS_STEP_US);
+}
+
+/* After blocking work: don't count it as a late frame or let the ball
+   catch up on it */
+void restartFrames(void)
+{
+	frameRestart(&pacer, us_ticker_read());
+	frameSteps = 0;
+}
+
+/* Frame statistics for the last level, to the USB serial port */
+unsigned int spiBytesMark = 0;
+unsigned int droppedMark = 0;
+
+void resetFrameStats(void)
+{
+	frameResetStats(&pacer);
+	spiBytesMark = spiBus.bytes;
+	eventResetStats(&events);
+	droppedMark = events.dropped;
+}
+
+void reportFrames(void)
+{
+	printf("frames %lu late %lu skipped %lu work avg %lu us max %lu us load %d%% spi %lu bytes\r\n",
+	       (unsigned long)pacer.frames, (unsigned long)pacer.late, (unsigned long)pacer.skipped,
+	       (unsigned long)frameWorkAvg(&pacer), (unsigned long)pacer.workMax, frameLoad(&pacer),
+	       (unsigned long)(spiBus.bytes - spiBytesMark));
+	printf("touch events %u latency avg %lu us max %lu us dropped %u\r\n",
+	       events.count, (unsigned long)eventLatencyAvg(&events), (unsigned long)events.latencyMax,
+	       events.dropped - droppedMark);
+	reportHint();
+	resetFrameStats();
+}
+
+void putLine(void *ctx, const char *line)
+{
+	fputs(line, stdout);
+}
+
+/* The run so far, to the USB serial port; recording carries on */
+void dumpRecording(void)
+{
+	recDump(&recorder, putLine, NULL);
+	// not a late frame; the steps this one owes are already logged
+	frameRestart(&pacer, us_ticker_read());
+}
+
+/* A dumped run from the USB serial port, up to its END line */
+int loadReplay(void)
+{
+	char line[REC_DUMP_LINE*2 + 8];
+	int len = 0, n = 0, c;
+	
+	printf("paste a recording\r\n");
+	for (;;) {
+		c = getchar();
+		if (c == '\r' || c == '\n' || c == EOF) {
+			line[len] = 0;
+			len = 0;
+			if (strcmp(line, "END") == 0) {
+				break;
+			}
+			int got = replayParseHex(line, recBuf + n, REC_BUF_SIZE - n);
+			if (got < 0 || c == EOF) {
+				break;
+			}
+			n += got;
+		} else if (len < (int)sizeof(line) - 1) {
+			line[len++] = c;
+		}
+	}
+	printf("%d bytes\r\n", n);
+	return n;
+}
+
+/* Screen layers: what is painted under the ball (the level) is the
+   static layer, the ball is a sprite and the pause marker an overlay.
+   Whatever changes, only the pixels that differ are sent. */
+Compositor comp;
+#define BALL_SPRITE   0
+#define PAUSE_LEFT    0
+#define PAUSE_RIGHT   1
+
+/* Set while the ball is rolling into a zone and until the next one is
+   created; the physics and redraws leave it to the animation */
+int ballDropping = 0;
+
 /*Default constructor creates ball at start location*/
 Ball createBall(int x_start, int y_start, int radius, int color){
 	Ball ball; 
@@ -224,10 +534,13 @@ Ball createBall(int x_start, int y_start, int radius, int color){
 	ball.y_pos = y_start;
 	ball.radius = radius;
 	ball.color = color;
-	ball.xAcc = 0;
-	ball.yAcc = 0;
+	marbleInit(&ball.body, x_start, y_start, radius);
+	physics.pending = 0;
+	restartFrames();
+	ballDropping = 0;
 	
 	TFT.fillcircle(x_start,y_start,radius,color) ;
+	compSpritePlace(&comp, BALL_SPRITE, x_start, y_start, radius, color);
 
 	return ball;
 }
@@ -246,511 +559,773 @@ int bound(int src, int min, int max)
     return( value ) ;
 }
 
+/* Advance the marble by the ticks this frame owes, with the latest tilt */
+void stepBall(Ball *ball, int steps)
+{
+	// x,y accelerations are flipped due to orientation
+	readTilt();
+	physicsSetTilt(&physics, -tiltY(&tilt), tiltX(&tilt), ACC_1G);
+	physicsAdvance(&physics, &ball->body, steps * PHYS_STEP_US);
+}
+
+/* Spatial index of the current screen, walls for the physics */
+Grid grid;
+
+/* Solid pixels of the current screen, for the hint's test of where the
+   ball fits */
+Occupancy occupancy;
+
+/* Holes and goals of the current screen: which one the ball is in, or
+   near, is one lookup */
+ZoneField zoneField;
+
+/* The screen the ball is on. Every screen with a ball sets it up the
+   same way, walls into the physics and the grid, zones into the zone
+   field and both into the compositor's static layer, so they all share
+   one roll/redraw pipeline. Holes and goals are found by their field
+   zone's index. */
+#define ARENA_MAX_WALLS   4
+#define ARENA_MAX_GOALS   2
+PhysBox arenaWalls[ARENA_MAX_WALLS];
+Zone arenaHoles[LEVEL_MAX_HOLES];
+Zone arenaGoals[ARENA_MAX_GOALS];
+int arenaNumGoals = 0;
+
+void arenaBegin(void)
+{
+	gridInit(&grid, MAZE_WIDTH, MAZE_HEIGHT);
+	zoneFieldInit(&zoneField, MAZE_WIDTH, MAZE_HEIGHT);
+	occInit(&occupancy, MAZE_WIDTH, MAZE_HEIGHT);
+	compStaticBegin(&comp, MAZE_WIDTH, MAZE_HEIGHT, BACKGROUND);
+	numWalls = 0;
+	numHoles = 0;
+	arenaNumGoals = 0;
+}
+
+void arenaAddWall(Wall wall)
+{
+	if (numWalls == ARENA_MAX_WALLS) {
+		return;
+	}
+	PhysBox *b = &arenaWalls[numWalls];
+	b->x = wall.x_pos;
+	b->y = wall.y_pos;
+	b->w = wall.width;
+	b->h = wall.length;
+	gridAddBox(&grid, GRID_WALL, numWalls, b->x, b->y, b->w, b->h);
+	occFillRect(&occupancy, b->x, b->y, b->x+b->w, b->y+b->h);
+	compStaticRect(&comp, b->x, b->y, b->x+b->w, b->y+b->h, wall.color);
+	numWalls++;
+}
+
+/* A hole or goal in the zone field. The ball falls into a hole as soon
+   as it is over it and into a goal once it is well inside. */
+void fieldAddZone(Zone zone, int kind, int index)
+{
+	int reach = (kind == GRID_HOLE) ? zone.radius : zone.radius - 1;
+	zoneFieldAdd(&zoneField, kind, index, zone.x_pos, zone.y_pos, reach);
+}
+
+/* kind is GRID_HOLE or GRID_GOAL */
+void arenaAddZone(Zone zone, int kind)
+{
+	if (kind == GRID_HOLE && numHoles < LEVEL_MAX_HOLES) {
+		fieldAddZone(zone, kind, numHoles);
+		arenaHoles[numHoles++] = zone;
+	} else if (kind == GRID_GOAL && arenaNumGoals < ARENA_MAX_GOALS) {
+		fieldAddZone(zone, kind, arenaNumGoals);
+		arenaGoals[arenaNumGoals++] = zone;
+	} else {
+		return;
+	}
+	compStaticDisc(&comp, zone.x_pos, zone.y_pos, zone.radius, zone.color);
+}
+
+void arenaBuild(void)
+{
+	gridBuild(&grid);
+	compStaticBuild(&comp);
+	physicsSetWalls(&physics, arenaWalls, numWalls);
+	physicsSetGrid(&physics, &grid);
+}
+
+void tftFill(void *ctx, int x0, int y0, int x1, int y1, uint16_t color)
+{
+	TFT.fillspan(x0, y0, x1, y1, color);
+}
+
+/* Move the ball sprite; whatever it uncovers comes from the static layer */
+void moveBall(Ball *ball, int newX, int newY)
+{
+	compSpriteMove(&comp, BALL_SPRITE, newX, newY);
+	ball->x_pos = newX;
+	ball->y_pos = newY;
+}
+
+/* Pause marker, two bars in the middle of the screen */
+void showPause(int on)
+{
+	if (on == comp.overlays[PAUSE_LEFT].visible) {
+		return;
+	}
+	if (on) {
+		int x = MAZE_WIDTH/2, y = MAZE_HEIGHT/2;
+		compOverlayShow(&comp, PAUSE_LEFT, x-10, y-12, x-5, y+11, FOREGROUND);
+		compOverlayShow(&comp, PAUSE_RIGHT, x+4, y-12, x+9, y+11, FOREGROUND);
+	} else {
+		compOverlayHide(&comp, PAUSE_LEFT);
+		compOverlayHide(&comp, PAUSE_RIGHT);
+	}
+}
+
+/* The level being played */
+Level level;
+
+/* Show a level: one bulk paint when it was pre-rendered, otherwise
+   shape by shape from its draw list */
+void paintLevel(const Level *lv)
+{
+	for (int i=0;i<lv->numDraw;i++) {
+		const LevelDraw *d = &lv->draw[i];
+		if (d->op == LEVEL_DRAW_RUNS) {
+			TFT.BitmapRLE(d->x0, d->y0, d->x1-d->x0+1, d->y1-d->y0+1, lv->runs, lv->numRuns);
+		} else if (d->op == LEVEL_DRAW_RECT) {
+			TFT.fillrect(d->x0, d->y0, d->x1, d->y1, d->color);
+		} else if (d->op == LEVEL_DRAW_CIRCLE) {
+			TFT.fillcircle(d->x0, d->y0, d->r, d->color);
+		}
+	}
+}
+
+/* Levels: the built-in maze first, then a freshly generated one after
+   every win, alternating the generator and adding holes as it goes */
+const uint8_t *levelData = level1;
+int levelSize = level1Size;
+MazeGen mazeGen;
+uint8_t mazeLevel[2048];
+int mazeCount = 0;
+
+void nextMaze(void)
+{
+	MazeGenParams p;
+	p.algorithm = (mazeCount & 1) ? MAZE_KRUSKAL : MAZE_BACKTRACKER;
+	p.seed = us_ticker_read() | 1;
+	if (inputMode == INPUT_REPLAY) {
+		RecSample s;
+		if (replayTake(&replay, REC_SEED, &s)) {
+			p.seed = s.time;
+		}
+	} else if (inputMode == INPUT_RECORD) {
+		recSeed(&recorder, p.seed);
+	}
+	p.cols = 10; // 32x34 px cells leave the ball a 24 px corridor
+	p.rows = 7;
+	p.width = MAZE_WIDTH;
+	p.height = MAZE_HEIGHT;
+	p.wallThickness = WALL_FATNESS;
+	p.holeRadius = HOLE_RADIUS;
+	p.goalRadius = HOLE_RADIUS;
+	p.numHoles = (mazeCount < 8) ? 8 + mazeCount : 16;
+	p.background = BACKGROUND;
+	p.wallColor = WALL_COLOR;
+	p.holeColor = HOLE_COLOR;
+	p.goalColor = WIN_COLOR;
+	int n = mazeGenerate(&mazeGen, &p, mazeLevel, sizeof(mazeLevel), NULL);
+	if (n > 0) {
+		levelData = mazeLevel;
+		levelSize = n;
+		mazeCount++;
+	}
+}
+
+/* Zone for a level's hole or goal; it is already on screen */
+Zone levelZone(const LevelZone *z, int type)
+{
+	Zone zone;
+	zone.x_pos = z->x;
+	zone.y_pos = z->y;
+	zone.radius = z->radius;
+	zone.color = z->color;
+	zone.type = type;
+	return zone;
+}
+
 int wonGame = 0;
 int lostGame = 0;
 
-/* Win/Lose/Restart game - finish ball rolling, print ending */
+/* Animation timing */
+#define DROP_US       150000
+#define WIPE_US       300000
+#define REVEAL_US     400000
+#define HOLD_US       3000000
+
+/* Ball rolling into a zone: only the sprite moves, the zone is static */
+int dropX0, dropY0, dropX1, dropY1;
+
+void dropApply(void *ctx, int p)
+{
+	compSpriteMove(&comp, BALL_SPRITE, dropX0 + (dropX1-dropX0)*p/256, dropY0 + (dropY1-dropY0)*p/256);
+}
+
+void dropDone(void *ctx)
+{
+	// the zone is in the static layer, so the ball falls into it
+	compSpriteHide(&comp, BALL_SPRITE);
+}
+
+/* Screen cleared top to bottom, a band of rows per frame, instead of
+   one cls() that stalls everything */
+int wipeRow = 0;
+
+void wipeApply(void *ctx, int row)
+{
+	if (row > wipeRow) {
+		TFT.fillrect(0, wipeRow, MAZE_WIDTH-1, row-1, BACKGROUND);
+	}
+	wipeRow = row;
+}
+
+void wipeScreen(uint32_t delayUs)
+{
+	timelineAdd(&timeline, delayUs, WIPE_US, 0, MAZE_HEIGHT, TWEEN_LINEAR, wipeApply, NULL, NULL);
+}
+
+/* Text typed out a character at a time */
+typedef struct reveal {
+	const char *text;
+	int x;
+	int y;
+	unsigned char *font;
+	int shown;
+} Reveal;
+Reveal reveal;
+
+void revealApply(void *ctx, int n)
+{
+	Reveal *r = (Reveal *)ctx;
+	if (n == 0) {
+		r->shown = 0;
+		TFT.set_font(r->font);
+		TFT.locate(r->x, r->y);
+	}
+	while (r->shown < n) {
+		TFT.putc(r->text[r->shown++]);
+	}
+}
+
+void revealText(uint32_t delayUs, int x, int y, const unsigned char *font, const char *text)
+{
+	reveal.text = text;
+	reveal.x = x;
+	reveal.y = y;
+	reveal.font = (unsigned char *)font;
+	timelineAdd(&timeline, delayUs, REVEAL_US, 0, strlen(text), TWEEN_LINEAR, revealApply, NULL, &reveal);
+}
+
+/* Win/Lose/Restart game - roll the ball into the zone and, when the game
+   is over, wipe the maze and type the ending. This only starts the
+   animation; it plays out over the next frames. */
 ball marbleDrop(Ball ball, Zone zone) {
-	for (int i=3;i>0;i--) {
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,BACKGROUND) ;
-		ball.x_pos = ball.x_pos - (ball.x_pos - zone.x_pos)/i;
-		ball.y_pos = ball.y_pos - (ball.y_pos - zone.y_pos)/i;
-		TFT.fillcircle(zone.x_pos,zone.y_pos,zone.radius,zone.color) ;
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,ball.color) ;
-		wait(0.05);
-	}
-	wait(0.05);
+	uint32_t t = DROP_US + 50000;
+	
+	ballDropping = 1;
+	dropX0 = ball.x_pos;
+	dropY0 = ball.y_pos;
+	dropX1 = zone.x_pos;
+	dropY1 = zone.y_pos;
+	timelineAdd(&timeline, 0, DROP_US, 0, 256, TWEEN_EASE_IN, dropApply, dropDone, NULL);
 	
-	TFT.fillcircle(zone.x_pos,zone.y_pos,zone.radius,zone.color) ;
+	if (zone.type == 1 || zone.type == 0) {
+		wipeScreen(t + 500000);
+		t += 500000 + WIPE_US + 500000;
+		revealText(t, MAZE_WIDTH/4, MAZE_HEIGHT/2-20, Arial28x28, zone.type == 1 ? "you won! :D" : "you lost :(");
+		t += REVEAL_US;
+	}
+	// hold the ending
+	timelineAdd(&timeline, t, HOLD_US, 0, 0, TWEEN_LINEAR, NULL, NULL, NULL);
 	
-	TFT.set_font((unsigned char*) Arial28x28);
-	TFT.locate(MAZE_WIDTH/4, MAZE_HEIGHT/2-20) ;
-	if (zone.type == 1) {
-		wait(0.5);
-		TFT.cls();
-		wait(0.5);
-		TFT.printf("you won! :D") ;
-	} else if (zone.type == 0) {
-		wait(0.5);
-		TFT.cls();
-		wait(0.5);
-		TFT.printf("you lost :(") ;
-	}
-	wait(3);
+	ball.x_pos = zone.x_pos;
+	ball.y_pos = zone.y_pos;
 	return ball;
 }
 
-// check for wall collisions and return coordinate
-int checkWalls(int newX, int newY, Ball ball, Wall wall) {
-		int wallMinX = bound(wall.x_pos-ball.radius,0.0,MAZE_WIDTH);
-		int wallMaxX = bound(wall.x_pos+wall.width+ball.radius,0.0,MAZE_WIDTH);
-		int wallMinY = bound(wall.y_pos-ball.radius,0.0,MAZE_HEIGHT);
-		int wallMaxY = bound(wall.y_pos+wall.length+ball.radius,0.0,MAZE_HEIGHT);
-	
-    int coord = 0;
-    if (newX > wallMinX-1 && newX < wallMaxX+1 &&
-				newY > wallMinY-1 && newY < wallMaxY+1) {
-			coord = 1;
-		}
-    return coord ;
-}
+/* The ball of the current scene */
+Ball ball;
 
-/* Recalculation of ball's movement, and checks */
-ball marbleRoll(Ball ball, Zone win, wall arrayWalls[12], zone arrayHoles[13])
+/* Shared by every scene with a ball: advance it by the frame's steps
+   and return the zone it has rolled into, if any */
+Zone *ballUpdate(int steps)
 {
+	if (ballDropping) {
+		return NULL;
+	}
 	backlight = 1 ;
+	// walls and screen edges are handled by the physics
+	stepBall(&ball, steps);
+	int x = marbleX(&ball.body);
+	int y = marbleY(&ball.body);
 	
-	// x,y accelerations are flipped due to orientation
-	ball.xAcc = (20 * (acc->getAccY())) ;
-	ball.yAcc = (20 * (acc->getAccX())) ;
-	
-	// get new positions
-	int newX = bound(ball.x_pos - ball.xAcc,ball.radius,MAZE_WIDTH-ball.radius);
-	int newY = bound(ball.y_pos + ball.yAcc,ball.radius,MAZE_HEIGHT-ball.radius);
-	
-	// wall collision check
-	for (int i=0;i<numWalls;i++) {
-		Wall wall = arrayWalls[i];
-		
-		int inWall = checkWalls(newX, newY, ball, wall);
-	
-		if (inWall) {
-			// Sliding
-			if (newX+ball.radius > wall.x_pos+wall.width || newX-ball.radius < wall.x_pos) {
-				newX = ball.x_pos;
-			}
-			if (newY+ball.radius > wall.y_pos || newY-ball.radius < wall.y_pos+wall.length) {
-				newY = ball.y_pos;
-			}
-			
-			if (newX+ball.radius == wall.x_pos) {
-				newX -= 0.1;
-			} else if (newX-ball.radius == wall.x_pos+wall.width) {
-				newX += 0.1;
-			}
-			if (newY+ball.radius == wall.y_pos) {
-				newY += 0.1;
-			} else if (newY-ball.radius == wall.y_pos+wall.length) {
-				newY -= 0.1;
-			}
-		}
+	int hit = zoneFieldHit(&zoneField, x, y);
+	if (hit < 0) {
+		return NULL;
 	}
-	
-	// update only if moved
-	if (!(newX == ball.x_pos && newY == ball.y_pos)) {
-		// erase ball
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,BACKGROUND) ;
-		
-		ball.x_pos = newX;
-		ball.y_pos = newY;
-		
-		// redraw win zone
-		int distFromWin = (int) sqrt(1.0*((ball.x_pos-win.x_pos)*(ball.x_pos-win.x_pos)) + 1.0*((ball.y_pos-win.y_pos)*(ball.y_pos-win.y_pos)));
-		if (distFromWin < 2*win.radius) {
-			TFT.fillcircle(win.x_pos,win.y_pos,win.radius,win.color) ;
-		}
-		// redraw holes
-		for (int i=0;i<numHoles;i++) {
-			Zone hole = arrayHoles[i];
-			int distFromHole = (int) sqrt(1.0*((ball.x_pos-hole.x_pos)*(ball.x_pos-hole.x_pos)) + 1.0*((ball.y_pos-hole.y_pos)*(ball.y_pos-hole.y_pos)));
-			if (distFromHole < 2*hole.radius) {
-				TFT.fillcircle(hole.x_pos,hole.y_pos,hole.radius,hole.color) ;
-			}
-		}
-		
-		// redraw ball
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,ball.color) ;
-		
-		// check if won
-		if (abs(ball.x_pos - win.x_pos) < win.radius && abs(ball.y_pos - win.y_pos) < win.radius) {
-			wonGame = 1;
-			ball = marbleDrop(ball, win);
-		} else {
-		// check if died
-			for (int i=0;i<numHoles;i++) {
-				Zone hole = arrayHoles[i];
-				if (abs(ball.x_pos - hole.x_pos) <= hole.radius && abs(ball.y_pos - hole.y_pos) <= hole.radius) {
-					lostGame = 1;
-				}
-				if (lostGame) {
-					ball = marbleDrop(ball, hole);
-					break;
-				}
+	const FieldZone *z = &zoneField.zones[hit];
+	return (z->kind == GRID_GOAL) ? &arenaGoals[z->index] : &arenaHoles[z->index];
+}
+
+/* Draw the ball where the physics has it; only the pixels that change */
+void ballRender(void)
+{
+	int x = marbleX(&ball.body);
+	int y = marbleY(&ball.body);
+	if (!ballDropping && !(x == ball.x_pos && y == ball.y_pos)) {
+		moveBall(&ball, x, y);
+	}
+}
+
+/* Hints: a flow field from the goal over the level's 8 px cells, built
+   a slice per frame within HINT_BUDGET_US once the hint is switched on,
+   so a level played without it costs nothing. A cell is open when the
+   ball fits there clear of walls and holes. The arrow is one of eight
+   masks made at start-up, as an overlay by the ball. */
+#define HINT_ARROW      2       // overlay id
+#define HINT_BUDGET_US  2000
+#define HINT_SLICE      32      // cells between looks at the clock
+#define HINT_OFFSET     (BALL_RADIUS+8)
+static const int HINT_COLOR = Yellow;
+
+FlowField flow;
+uint16_t hintArrows[8][FLOW_ARROW_SIZE];
+int hintCell = 0;       // next cell to classify
+int hintReady = 0;      // the field is final
+uint32_t hintUs = 0;
+int hintFrames = 0;
+int hintDir = FLOW_NONE;
+int hintX, hintY;
+
+void hintInit(void)
+{
+	for (int d=0;d<8;d++) {
+		flowArrow(d, hintArrows[d]);
+	}
+}
+
+void hintBegin(void)
+{
+	flowInit(&flow, MAZE_WIDTH, MAZE_HEIGHT);
+	hintCell = 0;
+	hintReady = 0;
+	hintUs = 0;
+	hintFrames = 0;
+}
+
+/* Can the ball pass through the cell centred on x,y? It is open if the
+   ball fits with its centre at any of nine points spread over it, so
+   a gap the ball fits through is not closed off by the coarse cells,
+   and it is blocked within half a cell of a hole. */
+int hintOpen(int x, int y)
+{
+	int half = (1 << FLOW_CELL_SHIFT)/2;
+	int dist;
+	int z = zoneFieldNearest(&zoneField, x, y, &dist);
+	if (z >= 0 && zoneField.zones[z].kind == GRID_HOLE && dist <= half) {
+		return 0;
+	}
+	for (int dy=-1;dy<=1;dy++) {
+		for (int dx=-1;dx<=1;dx++) {
+			if (!occTestDisc(&occupancy, x + dx*(half-1), y + dy*(half-1), BALL_RADIUS)) {
+				return 1;
 			}
 		}
 	}
-	return ball;
+	return 0;
 }
 
-int playAgain = 1;
-void Game(void) {
-	for (;;) {
-		TFT.cls();
-		wonGame = 0;
-		lostGame = 0;
-		printed = 0;
-		paused = 0;
-		// Initialize labyrinth / walls
-		/*fillrect() -> drawrect() for an outline if you want.*/
-		/* set WALL_COLOR above if you want red instead of black, etc */
-		numWalls = 12;
-		struct wall arrayWalls[numWalls];
-		arrayWalls[0] = createWall(0, 0, MAZE_WIDTH, WALL_FATNESS, FRAME_COLOR);
-		arrayWalls[1] = createWall(0, 0, WALL_FATNESS, MAZE_HEIGHT, FRAME_COLOR);
-		arrayWalls[2] = createWall(0, MAZE_HEIGHT - WALL_FATNESS, MAZE_WIDTH, WALL_FATNESS, FRAME_COLOR);
-		arrayWalls[3] = createWall(MAZE_WIDTH - WALL_FATNESS, 0, WALL_FATNESS, MAZE_HEIGHT, FRAME_COLOR);
-
-		arrayWalls[4] = createWall(0, 50, 230, WALL_FATNESS, WALL_COLOR); //first horizontal wall
-		arrayWalls[5] = createWall(214, 100, MAZE_WIDTH-214, WALL_FATNESS, WALL_COLOR); //second horizontal wall
-		arrayWalls[6] = createWall(50, 150, 164, WALL_FATNESS, WALL_COLOR); // third horizontal wall
-		arrayWalls[7] = createWall(50, 100, WALL_FATNESS, 100, WALL_COLOR); //leftmost vertical wall
-		arrayWalls[8] = createWall(150, 50, WALL_FATNESS, 50+WALL_FATNESS, WALL_COLOR); //uppermiddle vertical wall
-		arrayWalls[9] = createWall(106, 185, WALL_FATNESS, MAZE_HEIGHT-110, WALL_COLOR); //lowermiddle vertical wall
-		arrayWalls[10] =  createWall(214, 100, WALL_FATNESS, 105, WALL_COLOR); //right most vertical wall
-		arrayWalls[11] =  createWall(MAZE_WIDTH-5*HOLE_RADIUS-WALL_FATNESS, FINISH_Y_POS+2*HOLE_RADIUS-2, HOLE_RADIUS*9+WALL_FATNESS, WALL_FATNESS, WALL_COLOR); //win wall
-		
-		numHoles = 13;
-		struct zone arrayHoles[numHoles];
-
-		arrayHoles[0] = createZone(FINISH_X_POS, WALL_FATNESS + 10 + HOLE_RADIUS, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[1] = createZone(WALL_FATNESS + 6 + HOLE_RADIUS, 73, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[2] = createZone(243, 175, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[3] = createZone(100, 100, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[4] = createZone(295, 215, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[5] = createZone(60, 35, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[6] = createZone(125, 25, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[7] = createZone(214, 35, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[8] =  createZone(182, 130, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[9] = createZone(WALL_FATNESS + 6 + HOLE_RADIUS, MAZE_HEIGHT - WALL_FATNESS - 6 - HOLE_RADIUS, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[10] = createZone(157, 180, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[11] = createZone(MAZE_WIDTH*3/4+20, 75, HOLE_RADIUS, HOLE_COLOR, 0);
-		arrayHoles[12] = createZone(WALL_FATNESS + 17 + HOLE_RADIUS, MAZE_HEIGHT/2+24, HOLE_RADIUS, HOLE_COLOR, 0);
-		
-		// Initialize win zone
-		Zone win = createZone(FINISH_X_POS, FINISH_Y_POS, HOLE_RADIUS, WIN_COLOR, 1);
-		
-		// Initialize ball
-		Ball ball = createBall(START_X_POS, START_Y_POS, BALL_RADIUS, BALL_COLOR);
-		
-		for(;;) {
-			if (paused) {
-				//do nothing
-			} else if (wonGame || lostGame) {
-				if (!printed) {
-					wait(0.5);
-					TFT.cls();
-					wait(0.5);
-					TFT.set_font((unsigned char*) Arial28x28);
-					TFT.locate(MAZE_WIDTH/4+4, MAZE_HEIGHT/2-65) ;
-					TFT.printf("play again?");
-					TFT.set_font((unsigned char*) Arial24x23);
-					TFT.locate(MAZE_WIDTH/4+15, MAZE_HEIGHT/2+30) ;
-					TFT.printf("yes");
-					TFT.locate(MAZE_WIDTH/2+23, MAZE_HEIGHT/2+30) ;
-					TFT.printf("no");
-					printed = 1;
-					
-					// Initialize ball
-					ball = createBall(START_X_POS, START_Y_POS, BALL_RADIUS, BALL_COLOR);
-				}
-				
-				// Initialize "yes"
-				Zone yes = createZone(TFT.width()*3/8, TFT.height()/2, HOLE_RADIUS*2, Green, 2);
-				
-				// Initialize "no"
-				Zone no = createZone(TFT.width()*5/8, TFT.height()/2, HOLE_RADIUS*2, Red, 2);
-				
-				if (printed) {
-					
-					// x,y accelerations are flipped due to orientation
-					ball.xAcc = (40 * (acc->getAccY())) ;
-					ball.yAcc = (40 * (acc->getAccX())) ;
-					
-					// get new positions
-					int newX = bound(ball.x_pos - ball.xAcc,ball.radius,MAZE_WIDTH-ball.radius);
-					int newY = bound(ball.y_pos + ball.yAcc,ball.radius,MAZE_HEIGHT-ball.radius);
-		
-					// update only if moved
-					if (!(newX == ball.x_pos && newY == ball.y_pos)) {
-						// erase ball
-						TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,BACKGROUND) ;
-						
-						ball.x_pos = newX;
-						ball.y_pos = newY;
-						
-						// redraw ball
-						TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,ball.color) ;
-					}
-					
-					// do they want to restart?
-					if (abs(ball.x_pos - yes.x_pos) < yes.radius && abs(ball.y_pos - yes.y_pos) < yes.radius) {
-						ball = marbleDrop(ball, yes);
-						playAgain = 1;
-						break;
-					} else if (abs(ball.x_pos - no.x_pos) < no.radius && abs(ball.y_pos - no.y_pos) < no.radius) {
-						ball = marbleDrop(ball, no);
-						playAgain = 0;
-						break;
-					}
-					wait(0.01);
+/* This frame's share of the work: sort the cells into open and blocked,
+   then spread the distances out from the goal */
+void hintStep(void)
+{
+	if (hintReady || !hintOn) {
+		return;
+	}
+	uint32_t start = us_ticker_read();
+	int cells = flow.cols * flow.rows;
+	int half = (1 << FLOW_CELL_SHIFT)/2;
+	do {
+		if (hintCell < cells) {
+			for (int n=0;n<HINT_SLICE && hintCell<cells;n++,hintCell++) {
+				int x = (hintCell % flow.cols << FLOW_CELL_SHIFT) + half;
+				int y = (hintCell / flow.cols << FLOW_CELL_SHIFT) + half;
+				if (!hintOpen(x, y)) {
+					flowBlock(&flow, x, y);
 				}
-			} else {
-				printed = 0;
-				ball = marbleRoll(ball,win,arrayWalls,arrayHoles) ;
 			}
-			wait(0.01);
-
-		}
-		if (!playAgain) {
-			TFT.cls();
-			TFT.set_font((unsigned char*) Arial24x23);
-			TFT.locate(TFT.width()/4+10, TFT.height()/2-40);
-			TFT.printf("thank you");
-			TFT.locate(TFT.width()/4-10, TFT.height()/2+10);
-			TFT.printf("for playing!");
-			break;
+			if (hintCell == cells) {
+				flowAddGoal(&flow, level.goal.x, level.goal.y);
+			}
+		} else if (flowUpdate(&flow, HINT_SLICE)) {
+			hintReady = 1;
 		}
-//		wait(0.1);
+	} while (!hintReady && us_ticker_read() - start < HINT_BUDGET_US);
+	hintUs += us_ticker_read() - start;
+	hintFrames++;
+}
+
+/* What the field cost this level, with the frame statistics; nothing
+   if the hint was never on */
+void reportHint(void)
+{
+	if (hintFrames == 0) {
+		return;
 	}
+	printf("hint %dx%d cells, %lu visits, %d bytes, %lu us over %d frames%s\r\n",
+	       flow.cols, flow.rows, (unsigned long)flow.visits, (int)(sizeof(flow) + sizeof(hintArrows)),
+	       (unsigned long)hintUs, hintFrames, hintReady ? "" : " (unfinished)");
 }
 
-/* Recalculation of ball's movement, and checks */
-ball marbleRoll2(Ball ball, Zone win, wall arrayWalls[2], zone arrayHoles[1])
+/* Way to the goal from the ball, FLOW_NONE when there is none to show */
+int hintDirection(void)
 {
-	backlight = 1 ;
-	
-	// x,y accelerations are flipped due to orientation
-	ball.xAcc = (20 * (acc->getAccY())) ;
-	ball.yAcc = (20 * (acc->getAccX())) ;
-	
-	// get new positions
-	int newX = bound(ball.x_pos - ball.xAcc,ball.radius,MAZE_WIDTH-ball.radius);
-	int newY = bound(ball.y_pos + ball.yAcc,ball.radius,MAZE_HEIGHT-ball.radius);
-	
-	// wall collision check
-	for (int i=0;i<numWalls;i++) {
-		Wall wall = arrayWalls[i];
-		
-		int inWall = checkWalls(newX, newY, ball, wall);
+	if (!hintReady || ballDropping) {
+		return FLOW_NONE;
+	}
+	return flowDirection(&flow, ball.x_pos, ball.y_pos);
+}
+
+/* Arrow next to the ball; it only moves once the ball has gone a few
+   pixels or the way has turned */
+void showHint(int on)
+{
+	int dir = on ? hintDirection() : FLOW_NONE;
 	
-		if (inWall) {
-			// Sliding
-			if (newX+ball.radius > wall.x_pos+wall.width || newX-ball.radius < wall.x_pos) {
-				newX = ball.x_pos;
-			}
-			if (newY+ball.radius > wall.y_pos || newY-ball.radius < wall.y_pos+wall.length) {
-				newY = ball.y_pos;
-			}
-			
-			if (newX+ball.radius == wall.x_pos) {
-				newX -= 0.1;
-			} else if (newX-ball.radius == wall.x_pos+wall.width) {
-				newX += 0.1;
-			}
-			if (newY+ball.radius == wall.y_pos) {
-				newY += 0.1;
-			} else if (newY-ball.radius == wall.y_pos+wall.length) {
-				newY -= 0.1;
-			}
-		}
+	if (dir == FLOW_NONE) {
+		compOverlayHide(&comp, HINT_ARROW);
+		hintDir = FLOW_NONE;
+		return;
+	}
+	int offset = (dir & 1) ? HINT_OFFSET*181/256 : HINT_OFFSET;
+	int x = ball.x_pos + flowStepX[dir]*offset - FLOW_ARROW_SIZE/2;
+	int y = ball.y_pos + flowStepY[dir]*offset - FLOW_ARROW_SIZE/2;
+	if (dir == hintDir && abs(x - hintX) < 3 && abs(y - hintY) < 3) {
+		return;
 	}
+	compOverlayMask(&comp, HINT_ARROW, x, y, FLOW_ARROW_SIZE, FLOW_ARROW_SIZE, hintArrows[dir], HINT_COLOR);
+	hintDir = dir;
+	hintX = x;
+	hintY = y;
+}
+
+SceneManager scenes;
+extern const Scene titleScene, instrScene, readyScene, gameScene, againScene, byeScene;
+
+/* Title: calibrate the tilt if needed, then hold for 5 s or a tap */
+int titleCalibrating = 0;
+uint32_t titleUs = 0;
+
+void titleEnter(void *ctx)
+{
+	TFT.set_font((unsigned char*) Neu42x35);
+	TFT.locate(MAZE_WIDTH/8-2, MAZE_HEIGHT/2-20) ;
+	TFT.printf("LABYRINTH") ;
 	
-	// update only if moved
-	if (!(newX == ball.x_pos && newY == ball.y_pos)) {
-		// erase ball
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,BACKGROUND) ;
-		
-		ball.x_pos = newX;
-		ball.y_pos = newY;
-		
-		// redraw win zone
-		int distFromWin = (int) sqrt(1.0*((ball.x_pos-win.x_pos)*(ball.x_pos-win.x_pos)) + 1.0*((ball.y_pos-win.y_pos)*(ball.y_pos-win.y_pos)));
-		if (distFromWin < 2*win.radius) {
-			TFT.fillcircle(win.x_pos,win.y_pos,win.radius,win.color) ;
-		}
-		// redraw holes
-		for (int i=0;i<numHoles;i++) {
-			Zone hole = arrayHoles[i];
-			int distFromHole = (int) sqrt(1.0*((ball.x_pos-hole.x_pos)*(ball.x_pos-hole.x_pos)) + 1.0*((ball.y_pos-hole.y_pos)*(ball.y_pos-hole.y_pos)));
-			if (distFromHole < 2*hole.radius) {
-				TFT.fillcircle(hole.x_pos,hole.y_pos,hole.radius,hole.color) ;
-			}
-		}
-		
-		// redraw ball
-		TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,ball.color) ;
-		
-		// check if won
-		if (abs(ball.x_pos - win.x_pos) < win.radius && abs(ball.y_pos - win.y_pos) < win.radius) {
-			wonGame = 1;
-			ball = marbleDrop(ball, win);
-		} else {
-		// check if died
-			for (int i=0;i<numHoles;i++) {
-				Zone hole = arrayHoles[i];
-				if (abs(ball.x_pos - hole.x_pos) <= hole.radius && abs(ball.y_pos - hole.y_pos) <= hole.radius) {
-					lostGame = 1;
-				}
-				if (lostGame) {
-					ball = marbleDrop(ball, hole);
-					break;
-				}
+	// capture the level offsets while the title is up, unless a previous run left them
+	titleCalibrating = !loadTiltCalibration();
+	if (titleCalibrating) {
+		tiltCalibrate(&tilt, 64);
+	}
+	titleUs = 0;
+	touchTapped = 0;
+}
+
+void titleUpdate(void *ctx, int steps)
+{
+	if (titleCalibrating) {
+		readTilt();
+		if (!tiltCalibrating(&tilt)) {
+			if (tilt.calibrated) {
+				saveTiltCalibration();
 			}
+			titleCalibrating = 0;
 		}
+		return;
+	}
+	titleUs += steps * PHYS_STEP_US;
+	if (titleUs >= 5000000 || touchTapped) {
+		sceneChange(&scenes, &instrScene);
 	}
-	return ball;
 }
 
-void Instr(void) {
-	
-	TFT.cls();
-	
+/* Leave a screen by wiping it */
+void wipeExit(void *ctx)
+{
+	wipeScreen(0);
+}
+
+/* Instructions: a walled path with a hole, in two parts */
+int instrPart = 0;
+int instrHinted = 0;
+
+void instrEnter(void *ctx)
+{
 	// Initialize ball
-	Ball ball = createBall(START_X_POS*2, MAZE_HEIGHT/6, BALL_RADIUS, BALL_COLOR);
-	
-	// Initialize walls
-	numWalls = 2;
-	struct wall arrayWalls[numWalls];
-	arrayWalls[0] =  createWall(0, MAZE_HEIGHT/3, MAZE_WIDTH*3/4, WALL_FATNESS, WALL_COLOR); //top wall
-	arrayWalls[1] =  createWall(MAZE_WIDTH/4, MAZE_HEIGHT*2/3, MAZE_WIDTH*3/4, WALL_FATNESS, WALL_COLOR); //bottom wall
-	
-	// Initialize hole
-	numHoles = 1;
-	struct zone arrayHoles[numWalls];
-	arrayHoles[0] = createZone(MAZE_WIDTH/2, MAZE_HEIGHT/2+WALL_FATNESS, HOLE_RADIUS*2, HOLE_COLOR, 2);
+	ball = createBall(START_X_POS*2, MAZE_HEIGHT/6, BALL_RADIUS, BALL_COLOR);
 	
-	// Initialize win zone
-	Zone win = createZone(MAZE_WIDTH-START_X_POS*2, MAZE_HEIGHT*5/6+WALL_FATNESS, HOLE_RADIUS, WIN_COLOR, 2);
+	// Initialize walls, hole and win zone
+	arenaBegin();
+	arenaAddWall(createWall(0, MAZE_HEIGHT/3, MAZE_WIDTH*3/4, WALL_FATNESS, WALL_COLOR)); //top wall
+	arenaAddWall(createWall(MAZE_WIDTH/4, MAZE_HEIGHT*2/3, MAZE_WIDTH*3/4, WALL_FATNESS, WALL_COLOR)); //bottom wall
+	arenaAddZone(createZone(MAZE_WIDTH/2, MAZE_HEIGHT/2+WALL_FATNESS, HOLE_RADIUS*2, HOLE_COLOR, 2), GRID_HOLE);
+	arenaAddZone(createZone(MAZE_WIDTH-START_X_POS*2, MAZE_HEIGHT*5/6+WALL_FATNESS, HOLE_RADIUS, WIN_COLOR, 2), GRID_GOAL);
+	arenaBuild();
 		
 	// Print Text
 	TFT.set_font((unsigned char*) Arial12x12);
-	
 	TFT.locate(MAZE_WIDTH/4, MAZE_HEIGHT/4-20) ;
 	TFT.printf("follow the path...") ;
-	for (;;) {
-		ball = marbleRoll2(ball, win, arrayWalls, arrayHoles);
-		if (wonGame) {
-			wonGame=0;
+	instrPart = 0;
+	instrHinted = 0;
+	wonGame = 0;
+	lostGame = 0;
+}
+
+void instrUpdate(void *ctx, int steps)
+{
+	if (timelineBusy(&timeline)) {
+		return;
+	}
+	// after a drop, put the ball back where this part starts
+	if (wonGame || lostGame) {
+		if (instrPart == 1 && wonGame) {
+			sceneChange(&scenes, &readyScene);
+		} else if (instrPart == 0 && wonGame) {
 			ball = createBall(MAZE_WIDTH*3/4, MAZE_HEIGHT/2+WALL_FATNESS, BALL_RADIUS, BALL_COLOR);
+		} else {
+			ball = createBall(MAZE_WIDTH/4, MAZE_HEIGHT/2+WALL_FATNESS, BALL_RADIUS, BALL_COLOR);
 		}
-		if (lostGame || (ball.x_pos < arrayHoles[0].x_pos-arrayHoles[0].radius && ball.y_pos > arrayWalls[0].y_pos)) {
-			TFT.set_font((unsigned char*) Arial12x12);
-			TFT.locate(MAZE_WIDTH/2+35, MAZE_HEIGHT/2) ;
-			TFT.printf("avoid the holes!") ;
-			break;
-		}
-		wait(0.01);
+		wonGame = 0;
+		lostGame = 0;
+		return;
 	}
 	
-	if (lostGame) {
-		ball = createBall(MAZE_WIDTH/4, MAZE_HEIGHT/2+WALL_FATNESS, BALL_RADIUS, BALL_COLOR);
-		lostGame=0;
+	Zone *hit = ballUpdate(steps);
+	if (hit != NULL) {
+		wonGame = (hit == &arenaGoals[0]);
+		lostGame = !wonGame;
+		ball = marbleDrop(ball, *hit);
 	}
 	
-	int printed3=0;
-	for (;;) {
-		if (!printed3) {
-			if (ball.y_pos > arrayWalls[1].y_pos+WALL_FATNESS) {
-				TFT.set_font((unsigned char*) Arial12x12);
-				TFT.locate(MAZE_WIDTH/4, MAZE_HEIGHT*3/4+20) ;
-				TFT.printf("...get to the goal!") ;
-				printed3=1;
-			}
-		}
-		ball = marbleRoll2(ball, win, arrayWalls, arrayHoles);
-		if (lostGame) {
-			lostGame=0;
-			ball = createBall(MAZE_WIDTH/4, MAZE_HEIGHT/2+WALL_FATNESS, BALL_RADIUS, BALL_COLOR);
-		}
-		if (wonGame) {
-			wonGame=0;
-			break;
-		}
-		wait(0.01);
+	const Zone *hole = &arenaHoles[0];
+	if (instrPart == 0 && (lostGame || (ball.x_pos < hole->x_pos-hole->radius && ball.y_pos > arenaWalls[0].y))) {
+		TFT.set_font((unsigned char*) Arial12x12);
+		TFT.locate(MAZE_WIDTH/2+35, MAZE_HEIGHT/2) ;
+		TFT.printf("avoid the holes!") ;
+		instrPart = 1;
+	}
+	if (instrPart == 1 && !instrHinted && ball.y_pos > arenaWalls[1].y+WALL_FATNESS) {
+		TFT.set_font((unsigned char*) Arial12x12);
+		TFT.locate(MAZE_WIDTH/4, MAZE_HEIGHT*3/4+20) ;
+		TFT.printf("...get to the goal!") ;
+		instrHinted = 1;
 	}
+}
 
-	return;
+void ballSceneRender(void *ctx)
+{
+	ballRender();
 }
 
-void Ready(void) {
-	
-	TFT.cls();
-	
-	wait(0.2);
-	TFT.set_font((unsigned char*) Arial28x28);
-	TFT.locate(MAZE_WIDTH/4+20, MAZE_HEIGHT/4-20) ;
-	TFT.printf("READY?") ;
-	wait(0.5);
-	
-	// Initialize ball
-	Ball ball = createBall(START_X_POS*2, MAZE_HEIGHT/2, BALL_RADIUS, BALL_COLOR);
+/* Ready: roll into the goal to start */
+void readyEnter(void *ctx)
+{
+	revealText(0, MAZE_WIDTH/4+20, MAZE_HEIGHT/4-20, Arial28x28, "READY?");
 	
-	// Initialize win zone
-	Zone win = createZone(MAZE_WIDTH-START_X_POS*2, MAZE_HEIGHT/2, HOLE_RADIUS*2, WIN_COLOR, 2);
-	for (;;) {
-		
-		// x,y accelerations are flipped due to orientation
-		ball.xAcc = (20 * (acc->getAccY())) ;
-		ball.yAcc = (20 * (acc->getAccX())) ;
-		
-		// get new positions
-		int newX = bound(ball.x_pos - ball.xAcc,ball.radius,MAZE_WIDTH-ball.radius);
-		int newY = bound(ball.y_pos + ball.yAcc,ball.radius,MAZE_HEIGHT-ball.radius);
-
-		// update only if moved
-		if (!(newX == ball.x_pos && newY == ball.y_pos)) {
-			// erase ball
-			TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,BACKGROUND) ;
-			
-			ball.x_pos = newX;
-			ball.y_pos = newY;
-			
-			// redraw win zone
-			int distFromWin = (int) sqrt(1.0*((ball.x_pos-win.x_pos)*(ball.x_pos-win.x_pos)) + 1.0*((ball.y_pos-win.y_pos)*(ball.y_pos-win.y_pos)));
-			if (distFromWin < 2*win.radius) {
-				TFT.fillcircle(win.x_pos,win.y_pos,win.radius,win.color) ;
-			}
-			// redraw ball
-			TFT.fillcircle(ball.x_pos,ball.y_pos,ball.radius,ball.color) ;
-			
-			// check if won
-			if (abs(ball.x_pos - win.x_pos) < win.radius && abs(ball.y_pos - win.y_pos) < win.radius) {
-				wonGame = 1;
-				ball = marbleDrop(ball, win);
-			}
+	// Initialize ball and win zone
+	ball = createBall(START_X_POS*2, MAZE_HEIGHT/2, BALL_RADIUS, BALL_COLOR);
+	arenaBegin();
+	arenaAddZone(createZone(MAZE_WIDTH-START_X_POS*2, MAZE_HEIGHT/2, HOLE_RADIUS*2, WIN_COLOR, 2), GRID_GOAL);
+	arenaBuild();
+	// the first game is the built-in maze
+	wonGame = 0;
+}
+
+void readyUpdate(void *ctx, int steps)
+{
+	if (ballDropping) {
+		// the ball has dropped in; go once it has settled
+		if (!timelineBusy(&timeline)) {
+			sceneChange(&scenes, &gameScene);
 		}
-		
-		if (wonGame) {
-			wonGame=0;
-			break;
+		return;
+	}
+	Zone *hit = ballUpdate(steps);
+	if (hit != NULL) {
+		ball = marbleDrop(ball, *hit);
+	}
+}
+
+/* Game: the level. It is loaded (and after a win, generated) while the
+   previous screen wipes; entering only paints it. */
+int playAgain = 1;
+
+void gamePreload(void *ctx)
+{
+	if (wonGame) {
+		nextMaze();
+	}
+	// collision data, grid and draw list in one pass
+	if (levelLoad(&level, levelData, levelSize, &grid) != LEVEL_OK) {
+		error("level is corrupt\r\n");
+	}
+	numWalls = level.numWalls;
+	occInit(&occupancy, MAZE_WIDTH, MAZE_HEIGHT);
+	for (int i=0;i<numWalls;i++) {
+		const PhysBox *b = &level.walls[i];
+		occFillRect(&occupancy, b->x, b->y, b->x+b->w, b->y+b->h);
+	}
+	numHoles = level.numHoles;
+	zoneFieldInit(&zoneField, MAZE_WIDTH, MAZE_HEIGHT);
+	for (int i=0;i<numHoles;i++) {
+		arenaHoles[i] = levelZone(&level.holes[i], 0);
+		fieldAddZone(arenaHoles[i], GRID_HOLE, i);
+	}
+	arenaGoals[0] = levelZone(&level.goal, 1);
+	arenaNumGoals = 1;
+	fieldAddZone(arenaGoals[0], GRID_GOAL, 0);
+}
+
+void gameEnter(void *ctx)
+{
+	wonGame = 0;
+	lostGame = 0;
+	paused = 0;
+	paintLevel(&level);
+	compStaticLevel(&comp, &level);
+	physicsSetWalls(&physics, level.walls, level.numWalls);
+	physicsSetGrid(&physics, &grid);
+	ball = createBall(level.startX, level.startY, BALL_RADIUS, BALL_COLOR);
+	hintBegin();
+	resetFrameStats();
+}
+
+void gameUpdate(void *ctx, int steps)
+{
+	hintStep();
+	if (wonGame || lostGame) {
+		// the ending plays out, then the question
+		if (!timelineBusy(&timeline)) {
+			sceneChange(&scenes, &againScene);
 		}
-		wait(0.01);
+		return;
+	}
+	if (paused) {
+		// the ticks go by without being stepped, so the ball doesn't jump on resume
+		return;
+	}
+	Zone *hit = ballUpdate(steps);
+	if (hit != NULL) {
+		wonGame = (hit->type == 1);
+		lostGame = !wonGame;
+		ball = marbleDrop(ball, *hit);
 	}
-	
-	return;
-	
 }
 
-void Start(void) {
-	TFT.set_font((unsigned char*) Neu42x35);
-	TFT.locate(MAZE_WIDTH/8-2, MAZE_HEIGHT/2-20) ;
-	TFT.printf("LABYRINTH") ;
-	wait(5);
+void gameRender(void *ctx)
+{
+	ballRender();
+	// not over the ending, which has no layers
+	showPause(paused && !(wonGame || lostGame));
+	showHint(hintOn && !paused && !(wonGame || lostGame));
+}
+
+void gameExit(void *ctx)
+{
+	reportFrames();
+	wipeScreen(0);
+}
+
+/* Play again: roll into yes or no */
+void againEnter(void *ctx)
+{
+	revealText(0, MAZE_WIDTH/4+4, MAZE_HEIGHT/2-65, Arial28x28, "play again?");
+	TFT.set_font((unsigned char*) Arial24x23);
+	TFT.locate(MAZE_WIDTH/4+15, MAZE_HEIGHT/2+30) ;
+	TFT.printf("yes");
+	TFT.locate(MAZE_WIDTH/2+23, MAZE_HEIGHT/2+30) ;
+	TFT.printf("no");
 	
-	return;
+	// "yes" and "no" are all the ball can uncover; the maze is gone
+	arenaBegin();
+	arenaAddZone(createZone(TFT.width()*3/8, TFT.height()/2, HOLE_RADIUS*2, Green, 2), GRID_GOAL);
+	arenaAddZone(createZone(TFT.width()*5/8, TFT.height()/2, HOLE_RADIUS*2, Red, 2), GRID_GOAL);
+	arenaBuild();
+	ball = createBall(START_X_POS, START_Y_POS, BALL_RADIUS, BALL_COLOR);
+	paused = 0;
 }
-    
-int main()
-{    
+
+void againUpdate(void *ctx, int steps)
+{
+	if (ballDropping) {
+		if (!timelineBusy(&timeline)) {
+			sceneChange(&scenes, playAgain ? &gameScene : &byeScene);
+		}
+		return;
+	}
+	if (paused) {
+		return;
+	}
+	Zone *hit = ballUpdate(steps);
+	if (hit != NULL) {
+		playAgain = (hit == &arenaGoals[0]);
+		ball = marbleDrop(ball, *hit);
+	}
+}
+
+void againRender(void *ctx)
+{
+	ballRender();
+	showPause(paused);
+}
+
+void byeEnter(void *ctx)
+{
+	TFT.set_font((unsigned char*) Arial24x23);
+	TFT.locate(TFT.width()/4+10, TFT.height()/2-40);
+	TFT.printf("thank you");
+	TFT.locate(TFT.width()/4-10, TFT.height()/2+10);
+	TFT.printf("for playing!");
+}
+
+//                            name     preload      enter       update       render           exit
+const Scene titleScene = { "title", NULL,        titleEnter, titleUpdate, NULL,            wipeExit, NULL };
+const Scene instrScene = { "instr", NULL,        instrEnter, instrUpdate, ballSceneRender, wipeExit, NULL };
+const Scene readyScene = { "ready", NULL,        readyEnter, readyUpdate, ballSceneRender, wipeExit, NULL };
+const Scene gameScene  = { "game",  gamePreload, gameEnter,  gameUpdate,  gameRender,      gameExit, NULL };
+const Scene againScene = { "again", NULL,        againEnter, againUpdate, againRender,     wipeExit, NULL };
+const Scene byeScene   = { "bye",   NULL,        byeEnter,   NULL,        NULL,            NULL,     NULL };
+
+/* Everything up to the first frame */
+void gameSetup(void)
+{
+	eventQueueInit(&events);
+	
 	// Initialize screen
 	initTFT() ;
 	TFT.set_orientation(3);
+	touchCalInit(&touchCal, 240, 320, 4095);
+	touchCalSetOrientation(&touchCal, TFT.get_orientation());
+	gestureInit(&gestures);
 	MAZE_WIDTH = TFT.width();
 	MAZE_HEIGHT = TFT.height();
 	START_X_POS = WALL_FATNESS + BALL_RADIUS + 5;
 	START_Y_POS = WALL_FATNESS + BALL_RADIUS + 5;
 	FINISH_X_POS = MAZE_WIDTH - WALL_FATNESS - (2*BALL_RADIUS+10);
 	FINISH_Y_POS = MAZE_HEIGHT/2+5;
+	physicsInit(&physics, MAZE_WIDTH, MAZE_HEIGHT);
+	compInit(&comp, tftFill, NULL, MAZE_WIDTH, MAZE_HEIGHT, BACKGROUND);
+	hintInit();
+	frameInit(&pacer, PHYS_STEP_US, FRAME_TICKS);
+	frameTicker.attach_us(&frameTickHandler, PHYS_STEP_US);
+	timelineInit(&timeline);
 
 	backlight = 0 ;
 	TFT.background(BACKGROUND) ;
@@ -758,15 +1333,40 @@ int main()
 	
 	// Initialize accelerometer inputting thing
 	acc = new MMA8451Q(PTE25, PTE24, MMA8451_I2C_ADDRESS) ;
+	i2cQueue = new I2CQueueK64F(PTE25, PTE24) ; // 400 kHz, interrupt driven
+	acc->setQueue(i2cQueue);
+	tiltInit(&tilt, TILT_ONE/4, 4, 80); // ~0.02g dead-zone
+	acc->enableTapDetection(0x20, 0x30, 0xA0, 0xF0); // 2g, 30ms, 200ms, 300ms
+	acc->attachEvents(PIN_ACC_INT2, &acc_event_handler);
 	
-	// Start / intro / ready
-	Start();
-	Instr();
-	Ready();
-	wait(0.5);
+	if (inputMode == INPUT_REPLAY) {
+		replayInit(&replay, recBuf, loadReplay());
+	} else {
+		recInit(&recorder, recBuf, REC_BUF_SIZE);
+	}
 	
-	// Start game
-	Game();
-    
+	// Start / intro / ready / game, one frame at a time
+	sceneInit(&scenes);
+	sceneStart(&scenes, &titleScene);
+}
+
+void gameFrame(void)
+{
+	// touch or double tap toggles pause; costs no I2C unless the sensor fired
+	dispatchEvents();
+	acc->serviceEvents();
+	sceneFrame(&scenes, frameSteps, timelineBusy(&timeline));
+	nextFrame();
 }
 
+// the host simulator (tools/sim) has its own main() and drives the frames
+#ifndef LABYRINTH_SIM
+int main()
+{
+	gameSetup();
+	for (;;) {
+		gameFrame();
+	}
+}
+#endif
+
@@ -1,6 +1,7 @@
 #include "mbed.h"
 #include "ssd1289.h"
 #include "MyTouch.h"
+#include "EventQueue.h"
 
 // **********************************************************************
 // make bus for lcd data
@@ -15,25 +16,18 @@ SSD1289_LCD lcd( PA_11, PA_12, PB_13, PB_14, &lcdDataBus ); //CS, RESET, RS, WR,
 // create MYTOUCH class instance
 MYTOUCH MyTouch( PA_7, PA_6, PA_5, PB_6, PB_8, USE_12BITS, &mytouch_irq_handler); // mosi, miso, sck, cs, irq pin, mode, pointer to touch panel irq handler
 
+EventQueue events ;
+
+// Only queue the touch here; reading the panel and drawing happen in main()
 void mytouch_irq_handler(void)
     {
-        float xf, yf ;
-        x = MyTouch.TP_GetX();
-        y = MyTouch.TP_GetY();
-        xf = x ;
-        yf = y ;
-        xf = (xf/1024)*320 ;
-        yf = (yf/1024)*240 ;
-        x = (int)xf ;
-        y = (int)yf ;
-        lcd.DrawCircle(x,y,2, COLOR_GREEN) ;
-        wait(0.2);
+        eventPost(&events, EVENT_TOUCH, 0, us_ticker_read()) ;
     }
 // **********************************************************************
 
 
 int main() {
-    char text[24] ;
+    char text[32] ;
     x = 0 ;
     y = 0 ;
     // initialize display - place it in standard portrait mode and set background to black and
@@ -46,10 +40,28 @@ int main() {
     
     // set current font to the smallest 8x12 pixels font.
     lcd.SetFont(&TerminusFont ) ;    // print something on the screen
+    Timer textTimer ;
+    textTimer.start() ;
     while(1)
-        {        
-        sprintf(text,"X%d Y%d    ", x, y ) ;
-        lcd.Print(text, 15, 15 ) ;
-        wait(0.5) ;
+        {
+        Event ev ;
+        int px, py ;
+        while (eventGet(&events, &ev, us_ticker_read()))
+            {
+            // pressure checked and 5 samples per axis median filtered in one burst
+            if (ev.type == EVENT_TOUCH && MyTouch.TP_GetPoint(&px, &py, 5))
+                {
+                x = px ;
+                y = py ;
+                lcd.DrawCircle(x,y,2, COLOR_GREEN) ;
+                }
+            }
+        if (textTimer.read_ms() >= 500)
+            {
+            textTimer.reset() ;
+            sprintf(text,"X%d Y%d L%d  ", x, y, (int)events.latencyMax ) ;
+            lcd.Print(text, 15, 15 ) ;
+            }
+        wait_ms(5) ;
         }
 }
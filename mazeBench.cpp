@@ -0,0 +1,115 @@
+/* Labyrinth maze generator benchmark
+ *
+ * Generates 20x15 cell mazes on the 320x240 screen with both
+ * algorithms and reports the time per maze (target: under 50 ms), the
+ * memory used and the difficulty of what came out, on the USB serial
+ * port. The last maze of each kind is also drawn.
+ *
+ * Build this instead of mainMain.cpp (it has its own main()).
+ */
+
+#include "mbed.h"
+#include "SPI_TFT_ILI9341.h"
+#include "SPIBus.h"
+#include "MazeGen.h"
+#include "Level.h"
+
+#define PIN_MOSI        PTD2
+#define PIN_MISO        PTD3
+#define PIN_SCLK        PTD1
+#define PIN_CS_TFT      PTD0
+#define PIN_DC_TFT      PTC4
+#define PIN_BL_TFT      PTC3
+#define PIN_BACKLIGHT   PTA1
+
+#define BENCH_MAZES     100
+
+SPIBus spiBus(PIN_MOSI, PIN_MISO, PIN_SCLK) ;
+SPI_TFT_ILI9341 TFT(spiBus, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
+DigitalOut backlight(PIN_BACKLIGHT) ;
+
+static MazeGen gen;
+static Level level;
+static Grid grid;
+static uint8_t buf[4096];
+
+static void drawLevel(const Level *lv)
+{
+	for (int i = 0; i < lv->numDraw; i++) {
+		const LevelDraw *d = &lv->draw[i];
+		if (d->op == LEVEL_DRAW_RECT) {
+			TFT.fillrect(d->x0, d->y0, d->x1, d->y1, d->color);
+		} else if (d->op == LEVEL_DRAW_CIRCLE) {
+			TFT.fillcircle(d->x0, d->y0, d->r, d->color);
+		}
+	}
+}
+
+static void bench(int algorithm, const char *name)
+{
+	MazeGenParams p;
+	MazeGenStats s;
+	Timer t;
+	int genMax = 0, genSum = 0, loadMax = 0, diffSum = 0, bytesMax = 0, wallsMax = 0, fails = 0;
+
+	p.algorithm = algorithm;
+	p.cols = 20;
+	p.rows = 15;
+	p.width = TFT.width();
+	p.height = TFT.height();
+	p.wallThickness = 4;
+	p.holeRadius = 4;
+	p.goalRadius = 5;
+	p.numHoles = 12;
+	p.background = Black;
+	p.wallColor = Maroon;
+	p.holeColor = DarkGrey;
+	p.goalColor = Green;
+
+	t.start();
+	for (int i = 1; i <= BENCH_MAZES; i++) {
+		p.seed = i * 2654435761u;
+		t.reset();
+		int n = mazeGenerate(&gen, &p, buf, sizeof(buf), &s);
+		int genUs = t.read_us();
+		t.reset();
+		if (n == 0 || levelLoad(&level, buf, n, &grid) != LEVEL_OK) {
+			fails++;
+			continue;
+		}
+		int loadUs = t.read_us();
+		genSum += genUs;
+		genMax = genUs > genMax ? genUs : genMax;
+		loadMax = loadUs > loadMax ? loadUs : loadMax;
+		bytesMax = n > bytesMax ? n : bytesMax;
+		wallsMax = s.walls > wallsMax ? s.walls : wallsMax;
+		diffSum += s.difficulty;
+	}
+	// the averages are over the mazes that made it
+	int made = BENCH_MAZES - fails;
+	if (made == 0) {
+		made = 1;
+	}
+	printf("%-12s gen avg %5d us max %5d us, load max %5d us, level max %d bytes %d walls, avg difficulty %d, %d failed\r\n",
+	       name, genSum / made, genMax, loadMax, bytesMax, wallsMax, diffSum / made, fails);
+	printf("%-12s last: route %d cells, %d turns, %d dead ends, %d holes (%d beside the route)\r\n",
+	       "", s.pathCells, s.turns, s.deadEnds, s.holes, s.holesBeside);
+
+	drawLevel(&level);
+	wait(3);
+}
+
+int main()
+{
+	TFT.set_orientation(3);
+	backlight = 0 ;
+
+	printf("\r\nmaze generator: %d bytes working memory, level %d bytes, grid %d bytes\r\n",
+	       (int)sizeof(gen), (int)sizeof(level), (int)sizeof(grid));
+	bench(MAZE_BACKTRACKER, "backtracker");
+	bench(MAZE_KRUSKAL, "kruskal");
+
+	while (1) {
+		wait(1);
+	}
+}
@@ -0,0 +1,278 @@
+/* levelc - Labyrinth level compiler
+ *
+ * Turns a text level description into the binary format read by
+ * levelLoad() (see Labyrinth/Level.h), as a C++ source file with a const
+ * array to link into the firmware and optionally as a raw .bin file.
+ * Builds and runs on the host:
+ *
+ *   g++ -O2 -ILabyrinth -o levelc tools/levelc.cpp
+ *   ./levelc [-r] [-b level.bin] name level.txt > Level_name.cpp
+ *
+ * -r also pre-renders the level into background runs, painted exactly
+ * as the display driver's fillrect()/fillcircle() would, so the game can
+ * show it in one pass.
+ *
+ * Input, one item per line, '#' starts a comment, numbers may be hex:
+ *
+ *   size  <width> <height>
+ *   background <colour>
+ *   start <x> <y>
+ *   goal  <x> <y> <radius> <colour>
+ *   wall  <x> <y> <w> <h> <colour>
+ *   hole  <x> <y> <radius> <colour>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include "Level.h"   // the format and limits levelLoad() checks against
+
+struct Box {
+	int x, y, w, h, color;
+};
+
+struct Circle {
+	int x, y, r, color;
+};
+
+static int width = 320, height = 240, background = 0;
+static int startX = 0, startY = 0;
+static Circle goal;
+static std::vector<Box> walls;
+static std::vector<Circle> holes;
+
+static void fail(const char *file, int line, const char *msg)
+{
+	fprintf(stderr, "%s:%d: %s\n", file, line, msg);
+	exit(1);
+}
+
+static void parse(const char *file)
+{
+	FILE *f = fopen(file, "r");
+	char buf[256], word[32];
+	int line = 0, haveGoal = 0;
+
+	if (f == NULL) {
+		perror(file);
+		exit(1);
+	}
+	while (fgets(buf, sizeof(buf), f) != NULL) {
+		long v[5];
+		int n;
+		char *hash = strchr(buf, '#');
+
+		line++;
+		if (hash != NULL) {
+			*hash = 0;
+		}
+		if (sscanf(buf, "%31s", word) != 1) {
+			continue;
+		}
+		char *p = strstr(buf, word) + strlen(word);
+		for (n = 0; n < 5; n++) {
+			char *end;
+			v[n] = strtol(p, &end, 0);
+			if (end == p) {
+				break;
+			}
+			p = end;
+		}
+
+		if (strcmp(word, "size") == 0 && n == 2) {
+			width = v[0];
+			height = v[1];
+		} else if (strcmp(word, "background") == 0 && n == 1) {
+			background = v[0];
+		} else if (strcmp(word, "start") == 0 && n == 2) {
+			startX = v[0];
+			startY = v[1];
+		} else if (strcmp(word, "goal") == 0 && n == 4) {
+			Circle c = { (int)v[0], (int)v[1], (int)v[2], (int)v[3] };
+			goal = c;
+			haveGoal = 1;
+		} else if (strcmp(word, "wall") == 0 && n == 5) {
+			Box b = { (int)v[0], (int)v[1], (int)v[2], (int)v[3], (int)v[4] };
+			walls.push_back(b);
+		} else if (strcmp(word, "hole") == 0 && n == 4) {
+			Circle c = { (int)v[0], (int)v[1], (int)v[2], (int)v[3] };
+			holes.push_back(c);
+		} else {
+			fail(file, line, "unknown item or wrong number of values");
+		}
+	}
+	fclose(f);
+
+	if (!haveGoal) {
+		fail(file, line, "no goal");
+	}
+	if (walls.size() > LEVEL_MAX_WALLS || holes.size() > LEVEL_MAX_HOLES) {
+		fail(file, line, "too many walls or holes");
+	}
+}
+
+/* Software copies of the display driver's primitives, clipped */
+static std::vector<uint16_t> frame;
+
+static void vline(int x, int y0, int y1, int color)
+{
+	if (x < 0 || x >= width) {
+		return;
+	}
+	for (int y = y0 < 0 ? 0 : y0; y <= y1 && y < height; y++) {
+		frame[y * width + x] = color;
+	}
+}
+
+static void fillrect(int x0, int y0, int x1, int y1, int color)
+{
+	for (int x = x0; x <= x1; x++) {
+		vline(x, y0, y1, color);
+	}
+}
+
+static void fillcircle(int x0, int y0, int r, int color)
+{
+	int x = -r, y = 0, err = 2 - 2 * r, e2;
+	do {
+		vline(x0 - x, y0 - y, y0 + y, color);
+		vline(x0 + x, y0 - y, y0 + y, color);
+		e2 = err;
+		if (e2 <= y) {
+			err += ++y * 2 + 1;
+			if (-x == y && e2 <= x) e2 = 0;
+		}
+		if (e2 > x) err += ++x * 2 + 1;
+	} while (x <= 0);
+}
+
+static void render(std::vector<uint8_t> &runs, int &numRuns)
+{
+	size_t i;
+
+	frame.assign(width * height, background);
+	for (i = 0; i < walls.size(); i++) {
+		const Box &b = walls[i];
+		fillrect(b.x, b.y, b.x + b.w, b.y + b.h, b.color);
+	}
+	for (i = 0; i < holes.size(); i++) {
+		fillcircle(holes[i].x, holes[i].y, holes[i].r, holes[i].color);
+	}
+	fillcircle(goal.x, goal.y, goal.r, goal.color);
+
+	numRuns = 0;
+	for (i = 0; i < frame.size(); ) {
+		size_t j = i;
+		while (j < frame.size() && frame[j] == frame[i] && j - i < 0xFFFF) {
+			j++;
+		}
+		runs.push_back((j - i) & 0xFF);
+		runs.push_back((j - i) >> 8);
+		runs.push_back(frame[i] & 0xFF);
+		runs.push_back(frame[i] >> 8);
+		numRuns++;
+		i = j;
+	}
+}
+
+static void put8(std::vector<uint8_t> &out, int v)
+{
+	out.push_back(v & 0xFF);
+}
+
+static void put16(std::vector<uint8_t> &out, int v)
+{
+	out.push_back(v & 0xFF);
+	out.push_back((v >> 8) & 0xFF);
+}
+
+static void putZone(std::vector<uint8_t> &out, const Circle &c)
+{
+	put16(out, c.x);
+	put16(out, c.y);
+	put8(out, c.r);
+	put16(out, c.color);
+}
+
+int main(int argc, char **argv)
+{
+	const char *binFile = NULL;
+	int prerender = 0;
+	int arg = 1;
+
+	for (; arg < argc && argv[arg][0] == '-'; arg++) {
+		if (strcmp(argv[arg], "-r") == 0) {
+			prerender = 1;
+		} else if (strcmp(argv[arg], "-b") == 0 && arg + 1 < argc) {
+			binFile = argv[++arg];
+		} else {
+			break;
+		}
+	}
+	if (argc - arg != 2) {
+		fprintf(stderr, "usage: levelc [-r] [-b level.bin] name level.txt > Level_name.cpp\n");
+		return 2;
+	}
+	const char *name = argv[arg];
+	const char *file = argv[arg + 1];
+	parse(file);
+
+	std::vector<uint8_t> runs;
+	int numRuns = 0;
+	if (prerender) {
+		render(runs, numRuns);
+		if (numRuns > LEVEL_MAX_RUNS) {
+			fail(file, 0, "too many runs to pre-render");
+		}
+	}
+
+	std::vector<uint8_t> out;
+	out.push_back('L');
+	out.push_back('B');
+	out.push_back('Y');
+	out.push_back('L');
+	put8(out, LEVEL_VERSION);
+	put8(out, prerender ? LEVEL_FLAG_RUNS : 0);
+	put16(out, width);
+	put16(out, height);
+	put16(out, startX);
+	put16(out, startY);
+	put8(out, walls.size());
+	put8(out, holes.size());
+	put16(out, background);
+	put16(out, numRuns);
+	putZone(out, goal);
+	for (size_t i = 0; i < walls.size(); i++) {
+		put16(out, walls[i].x);
+		put16(out, walls[i].y);
+		put16(out, walls[i].w);
+		put16(out, walls[i].h);
+		put16(out, walls[i].color);
+	}
+	for (size_t i = 0; i < holes.size(); i++) {
+		putZone(out, holes[i]);
+	}
+	out.insert(out.end(), runs.begin(), runs.end());
+
+	if (binFile != NULL) {
+		FILE *f = fopen(binFile, "wb");
+		if (f == NULL || fwrite(&out[0], 1, out.size(), f) != out.size()) {
+			perror(binFile);
+			return 1;
+		}
+		fclose(f);
+	}
+
+	printf("/* Generated by tools/levelc from %s - do not edit */\n", file);
+	printf("#include \"Levels.h\"\n\n");
+	printf("/* %d walls, %d holes, %d runs */\n", (int)walls.size(), (int)holes.size(), numRuns);
+	printf("const unsigned char %s[] = {", name);
+	for (size_t i = 0; i < out.size(); i++) {
+		printf("%s0x%02X,", i % 16 ? " " : "\n\t", out[i]);
+	}
+	printf("\n};\n");
+	printf("const unsigned int %sSize = sizeof(%s);\n", name, name);
+	fprintf(stderr, "%s: %d bytes\n", name, (int)out.size());
+	return 0;
+}
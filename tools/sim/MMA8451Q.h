@@ -0,0 +1,70 @@
+/* Labyrinth simulator - MMA8451Q stand-in
+ *
+ * Same interface as MMA8451Q/MMA8451Q.h as far as the game uses it.
+ * Samples are whatever simAccelSet() last set and events whatever
+ * simAccelEvents() queued (see Sim.h); there is no bus.
+ */
+#ifndef MMA8451Q_H
+#define MMA8451Q_H
+
+#include "mbed.h"
+#include "I2CQueueK64F.h"
+
+extern int simAccel[3];
+extern int simAccelPending;
+
+class MMA8451Q
+{
+public:
+  enum {
+    EVENT_TAP         = 0x01,
+    EVENT_DOUBLE_TAP  = 0x02,
+    EVENT_SHAKE       = 0x04,
+    EVENT_ORIENTATION = 0x08
+  };
+
+  MMA8451Q(PinName sda, PinName scl, int addr) : m_ready(0), m_handler(0) { }
+
+  void setQueue(I2CQueueK64F *queue) { }
+
+  /* Latches the scripted sample; it is read back on the next frame
+     like the real transfer would be */
+  int requestAccAllAxis() {
+    for (int i = 0; i < 3; i++) {
+      m_latched[i] = simAccel[i];
+    }
+    m_ready = 1;
+    return 1;
+  }
+
+  int getLatchedAccAllAxisRaw(int16_t * res) {
+    if (!m_ready) {
+      return 0;
+    }
+    for (int i = 0; i < 3; i++) {
+      res[i] = m_latched[i];
+    }
+    m_ready = 0;
+    return 1;
+  }
+
+  void enableTapDetection(uint8_t threshold, uint8_t timeLimit, uint8_t latency, uint8_t window) { }
+
+  void attachEvents(PinName irq, void (*handler)(int events)) { m_handler = handler; }
+
+  int serviceEvents() {
+    int events = simAccelPending;
+    simAccelPending = 0;
+    if (events && m_handler) {
+      m_handler(events);
+    }
+    return events;
+  }
+
+private:
+  int16_t m_latched[3];
+  int m_ready;
+  void (*m_handler)(int events);
+};
+
+#endif
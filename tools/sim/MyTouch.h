@@ -0,0 +1,37 @@
+/* Labyrinth simulator - MYTOUCH stand-in
+ *
+ * Same interface as MyTouch/MyTouch.h as far as the game uses it. The
+ * panel reads whatever simTouchPress() set (see Sim.h), and pressing it
+ * calls the pen-down handler like the interrupt would.
+ */
+#ifndef MyTOUCH_H
+#define MyTOUCH_H
+
+#include "mbed.h"
+#include "SPIBus.h"
+
+#define USE_12BITS  0
+#define USE_8BITS   2
+
+extern int simTouchPressed;
+extern int simTouchRaw[2];
+extern void (*simTouchIrq)(void);
+
+class MYTOUCH
+{
+    public:
+        MYTOUCH(SPIBus &_bus, PinName _tp_cs, PinName _tp_irq, unsigned char _resolution, void (*pointer_To_TP_IRQ_Handler)(void)) {
+            simTouchIrq = pointer_To_TP_IRQ_Handler ;
+        }
+
+        int TP_GetRawPoint(int *_x, int *_y, int _samples) {
+            if (!simTouchPressed) {
+                return( 0 ) ;
+            }
+            *_x = simTouchRaw[0] ;
+            *_y = simTouchRaw[1] ;
+            return( 1 ) ;
+        }
+} ;
+
+#endif
@@ -0,0 +1,324 @@
+#include "Sim.h"
+
+uint8_t simPins[SIM_PINS];
+RFSYS_Type simRfsys;
+
+/* Clock and tickers */
+#define SIM_TICKERS       4
+#define SIM_NEVER         0xFFFFFFFFFFFFFFFFull
+
+uint64_t simNow = 0;
+uint64_t simNextTick = SIM_NEVER;
+
+static struct {
+	void (*fn)(void);
+	uint64_t period;
+	uint64_t next;
+} tickers[SIM_TICKERS];
+
+static void nextTick(void)
+{
+	simNextTick = SIM_NEVER;
+	for (int i = 0; i < SIM_TICKERS; i++) {
+		if (tickers[i].fn != 0 && tickers[i].next < simNextTick) {
+			simNextTick = tickers[i].next;
+		}
+	}
+}
+
+void simFireTickers(void)
+{
+	while (simNow >= simNextTick) {
+		for (int i = 0; i < SIM_TICKERS; i++) {
+			if (tickers[i].fn != 0 && tickers[i].next <= simNow) {
+				tickers[i].next += tickers[i].period;
+				tickers[i].fn();
+			}
+		}
+		nextTick();
+	}
+}
+
+void simSleep(void)
+{
+	if (simNextTick == SIM_NEVER) {
+		// nothing would ever wake us; let a millisecond go by
+		simAdvance(1000000);
+	} else {
+		simAdvance(simNextTick - simNow);
+	}
+}
+
+void Ticker::attach_us(void (*fn)(void), uint32_t us)
+{
+	detach();
+	for (int i = 0; i < SIM_TICKERS; i++) {
+		if (tickers[i].fn == 0) {
+			tickers[i].fn = fn;
+			tickers[i].period = (uint64_t)(us ? us : 1) * 1000;
+			tickers[i].next = simNow + tickers[i].period;
+			m_slot = i;
+			break;
+		}
+	}
+	nextTick();
+}
+
+void Ticker::detach(void)
+{
+	if (m_slot >= 0) {
+		tickers[m_slot].fn = 0;
+		m_slot = -1;
+		nextTick();
+	}
+}
+
+void error(const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	vfprintf(stderr, format, args);
+	va_end(args);
+	exit(1);
+}
+
+/* ILI9341 model */
+static uint16_t frame[SIM_PANEL_WIDTH * SIM_PANEL_HEIGHT];
+static PinName panelCs = NC;
+static PinName panelDc = NC;
+static int cmd = 0;
+static int argIndex = 0;
+static int colStart = 0, colEnd = SIM_PANEL_WIDTH - 1;
+static int pageStart = 0, pageEnd = SIM_PANEL_HEIGHT - 1;
+static int col = 0, page = 0;
+static int madctl = 0;
+static int highByte = -1;
+unsigned long simPanelPixels = 0;
+
+#define MADCTL_MY   0x80
+#define MADCTL_MX   0x40
+#define MADCTL_MV   0x20
+
+void simPanelAttach(PinName cs, PinName dc)
+{
+	panelCs = cs;
+	panelDc = dc;
+}
+
+/* Frame memory index of a column/page address under the current
+   memory access control */
+static int frameIndex(int c, int p)
+{
+	int x = c, y = p;
+	if (madctl & MADCTL_MV) {
+		x = p;
+		y = c;
+	}
+	if (madctl & MADCTL_MX) {
+		x = SIM_PANEL_WIDTH - 1 - x;
+	}
+	if (madctl & MADCTL_MY) {
+		y = SIM_PANEL_HEIGHT - 1 - y;
+	}
+	if (x < 0 || x >= SIM_PANEL_WIDTH || y < 0 || y >= SIM_PANEL_HEIGHT) {
+		return -1;
+	}
+	return y * SIM_PANEL_WIDTH + x;
+}
+
+/* The row being streamed, when it lies straight in the frame memory:
+   the address steps by a fixed stride within a row, so it is only
+   worked out at the start of one */
+uint16_t *simRun = 0;
+int simRunStride = 0;
+int simRunLeft = 0;
+int simRunLen = 0;
+
+static void startRow(void)
+{
+	int first = frameIndex(col, page);
+	int last = frameIndex(colEnd, page);
+	simRunLen = 0;
+	simRunLeft = 0;
+	if (first >= 0 && last >= 0 && colEnd >= col) {
+		simRunLen = colEnd - col + 1;
+		simRun = &frame[first];
+		simRunStride = simRunLen > 1 ? (last - first) / (colEnd - col) : 0;
+		simRunLeft = simRunLen;
+	}
+}
+
+/* Catch the address counter up with the pixels the fast path stored */
+static void syncRun(int next)
+{
+	if (!simRunLen) {
+		return;
+	}
+	int done = simRunLen - simRunLeft;
+	simPanelPixels += done;
+	col += done;
+	simRunLen = 0;
+	simRunLeft = 0;
+	if (col > colEnd) {
+		col = colStart;
+		if (++page > pageEnd) {
+			page = pageStart;
+		}
+		if (next) {
+			startRow();
+		}
+	}
+}
+
+void simRunEnd(void)
+{
+	syncRun(0);
+}
+
+static void writePixel(uint16_t color)
+{
+	if (simRunLeft) {
+		*simRun = color;
+		simRun += simRunStride;
+		simRunLeft--;
+		return;
+	}
+	// part of the row is off the frame memory
+	int i = frameIndex(col, page);
+	if (i >= 0) {
+		frame[i] = color;
+	}
+	simPanelPixels++;
+	if (++col > colEnd) {
+		col = colStart;
+		if (++page > pageEnd) {
+			page = pageStart;
+		}
+		startRow();
+	}
+}
+
+static void setAddress(int *start, int *end, int value)
+{
+	// the parameters come a byte at a time; a short write only sets the start
+	switch (argIndex) {
+	case 0: *start = value << 8; break;
+	case 1: *start |= value; break;
+	case 2: *end = value << 8; break;
+	case 3: *end |= value; break;
+	}
+}
+
+void simSpiWrite(int value, int bits)
+{
+	if (panelCs == NC || simPins[panelCs]) {
+		return;
+	}
+	syncRun(1);
+	if (!simPins[panelDc]) {
+		cmd = value & 0xFF;
+		argIndex = 0;
+		highByte = -1;
+		if (cmd == 0x2C) {
+			col = colStart;
+			page = pageStart;
+			startRow();
+		}
+		return;
+	}
+	switch (cmd) {
+	case 0x2A:
+		setAddress(&colStart, &colEnd, value & 0xFF);
+		break;
+	case 0x2B:
+		setAddress(&pageStart, &pageEnd, value & 0xFF);
+		break;
+	case 0x36:
+		madctl = value & 0xFF;
+		break;
+	case 0x2C:
+		if (bits == 16) {
+			writePixel(value);
+		} else if (highByte < 0) {
+			highByte = value & 0xFF;
+		} else {
+			writePixel(highByte << 8 | (value & 0xFF));
+			highByte = -1;
+		}
+		break;
+	}
+	argIndex++;
+}
+
+int simPanelWidth(void)
+{
+	return (madctl & MADCTL_MV) ? SIM_PANEL_HEIGHT : SIM_PANEL_WIDTH;
+}
+
+int simPanelHeight(void)
+{
+	return (madctl & MADCTL_MV) ? SIM_PANEL_WIDTH : SIM_PANEL_HEIGHT;
+}
+
+uint16_t simPanelPixel(int x, int y)
+{
+	int i = frameIndex(x, y);
+	return i >= 0 ? frame[i] : 0;
+}
+
+int simPanelDump(const char *path)
+{
+	FILE *f = fopen(path, "wb");
+	if (f == NULL) {
+		return 0;
+	}
+	int w = simPanelWidth(), h = simPanelHeight();
+	fprintf(f, "P6\n%d %d\n255\n", w, h);
+	for (int y = 0; y < h; y++) {
+		for (int x = 0; x < w; x++) {
+			uint16_t c = simPanelPixel(x, y);
+			// widen 5/6/5 bits to 8, repeating the top bits
+			unsigned char rgb[3];
+			rgb[0] = (c >> 8 & 0xF8) | (c >> 13);
+			rgb[1] = (c >> 3 & 0xFC) | (c >> 9 & 3);
+			rgb[2] = (c << 3 & 0xF8) | (c >> 2 & 7);
+			fwrite(rgb, 1, 3, f);
+		}
+	}
+	return fclose(f) == 0;
+}
+
+/* Scripted inputs, read by the MMA8451Q and MYTOUCH stand-ins */
+int simAccel[3] = { 0, 0, 4096 };
+int simAccelPending = 0;
+int simTouchPressed = 0;
+int simTouchRaw[2];
+void (*simTouchIrq)(void) = 0;
+
+void simAccelSet(int x, int y, int z)
+{
+	simAccel[0] = x;
+	simAccel[1] = y;
+	simAccel[2] = z;
+}
+
+void simAccelEvents(int events)
+{
+	simAccelPending |= events;
+}
+
+void simTouchPress(int rawX, int rawY)
+{
+	int down = !simTouchPressed;
+	simTouchPressed = 1;
+	simTouchRaw[0] = rawX;
+	simTouchRaw[1] = rawY;
+	if (down && simTouchIrq != 0) {
+		simTouchIrq();
+	}
+}
+
+void simTouchRelease(void)
+{
+	simTouchPressed = 0;
+}
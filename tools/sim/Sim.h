@@ -0,0 +1,44 @@
+/* Labyrinth simulator - simulated hardware
+ *
+ * The display is an ILI9341 model fed by the real SPI_TFT_ILI9341
+ * driver through the real SPIBus: it decodes the column/page address,
+ * memory write and memory access control commands into an RGB565
+ * frame memory, so what is drawn, and how many bytes it took, is what
+ * the board would see. The accelerometer and the touch panel are
+ * scripted: the simulator sets what they read next.
+ */
+#ifndef SIM_H
+#define SIM_H
+
+#include "mbed.h"
+
+#define SIM_PANEL_WIDTH   240     /* frame memory, portrait */
+#define SIM_PANEL_HEIGHT  320
+
+/* Display: the chip select and data/command pins the driver uses */
+void simPanelAttach(PinName cs, PinName dc);
+
+/* Size and contents as the program sees them, in the orientation it
+   last set */
+int simPanelWidth(void);
+int simPanelHeight(void);
+uint16_t simPanelPixel(int x, int y);
+
+/* Binary PPM of what is on screen; returns 0 if the file can't be written */
+int simPanelDump(const char *path);
+
+/* Pixels written to the frame memory so far */
+extern unsigned long simPanelPixels;
+
+/* Accelerometer: raw counts (4096 = 1g) returned from now on */
+void simAccelSet(int x, int y, int z);
+
+/* Accelerometer embedded function events (MMA8451Q::EVENT_* bits) for
+   the next serviceEvents() */
+void simAccelEvents(int events);
+
+/* Touch panel, raw ADC counts; pressing raises the pen-down interrupt */
+void simTouchPress(int rawX, int rawY);
+void simTouchRelease(void);
+
+#endif
@@ -0,0 +1,426 @@
+/* labsim - Labyrinth on the host
+ *
+ * Runs mainMain.cpp, with the real game modules, SPI_TFT_ILI9341 driver
+ * and SPIBus, against the simulated display, accelerometer, touch panel
+ * and clock of Sim.h, so games can be played, timed and checked without
+ * a board. Builds and runs on the host:
+ *
+ *   g++ -O2 -DLABYRINTH_SIM -Itools/sim -ILabyrinth -ISPIBus -ISPI_TFT_ILI9341 -ITFT_fonts \
+ *       -o labsim tools/sim/Sim.cpp tools/sim/labsim.cpp mainMain.cpp Labyrinth/[A-Z]*.cpp \
+ *       SPIBus/SPIBus.cpp SPI_TFT_ILI9341/[A-Z]*.cpp
+ *   ./labsim [-n games] [-s seed] [-e] [-h | -a] [-p screen.ppm]
+ *   ./labsim -r [-p screen.ppm] < dump.txt
+ *   ./labsim -c
+ *   ./labsim -g
+ *
+ * By default it plays levels with a random tilt script: a new tilt of up
+ * to 0.5g every half second, until the ball drops into a hole or the
+ * goal (-e also plays the ending). Every win generates the next maze,
+ * as on the board. -h plays with the hint arrow on; -a lets the hint
+ * steer instead of the random script, tilting the board gently the way
+ * the arrow points. With -r it replays a run recorded on the board (see
+ * dumpRecording() in mainMain.cpp) from the title screen on.
+ *
+ * It reports the draw cost per frame - SPI bytes, pixels and the time
+ * the bus takes for them at its clock - the frame pacer's view of
+ * simulated time, the host time per game and a hash of the final
+ * screen, which two builds playing the same inputs should agree on.
+ * -p saves the final screen as a PPM. -c checks the physics instead,
+ * rolling a marble over walls that meet flush, and exits 1 if it stops
+ * short. -g plays the touch and tap gestures on a level instead, checks
+ * that each one pauses, resumes or shows the hint as it should, and
+ * exits 1 if one does not; the long press dumps the recording.
+ */
+#include <time.h>
+#include "Sim.h"
+#include "SPIBus.h"
+#include "Scene.h"
+#include "Tween.h"
+#include "FramePacer.h"
+#include "Compositor.h"
+#include "FlowField.h"
+#include "Physics.h"
+#include "MMA8451Q.h"
+
+#define SIM_MAX_FRAMES    3000     /* 60 s at 50 Hz, then the game is called off */
+#define SIM_TILT_FRAMES   25       /* frames between tilt changes */
+#define SIM_TILT_MAX      2048     /* 0.5g */
+#define SIM_STEER_PUSH    450      /* tilt along the way, enough to get the ball rolling */
+#define SIM_STEER_GAIN    128      /* tilt per pixel off the middle of the cell */
+#define SIM_STEER_DAMP    96       /* tilt per pixel per frame of speed */
+#define SIM_STEER_MAX     1024     /* 0.25g */
+#define SIM_BUCKETS       8
+#define SIM_ROLL_STEPS    2000     /* physics steps a check roll gets */
+#define SIM_ROLL_TILT     205      /* ~0.05g along the roll, and each multiple up to SIM_ROLL_TILTS */
+#define SIM_ROLL_TILTS    6
+#define SIM_ROLL_PRESS    120      /* ~0.03g into the walls it rolls on */
+#define SIM_GESTURE_GAP   25       /* frames after a gesture, past the double tap window */
+#define SIM_LONG_PRESS    50       /* frames a long press is held, 1 s */
+#define SIM_SWIPE_STEP    400      /* raw counts a frame a swipe moves, ~25 px */
+
+/* From mainMain.cpp */
+void gameSetup(void);
+void gameFrame(void);
+extern int inputMode;
+extern SPIBus spiBus;
+extern SceneManager scenes;
+extern const Scene gameScene;
+extern Timeline timeline;
+extern FramePacer pacer;
+extern Compositor comp;
+extern int wonGame;
+extern int lostGame;
+extern int hintOn;
+extern int paused;
+extern int titleCalibrating;
+int hintDirection(void);
+
+/* Same values as in mainMain.cpp */
+#define INPUT_LIVE        0
+#define INPUT_RECORD      1
+#define INPUT_REPLAY      2
+
+/* Per-frame draw cost */
+typedef struct frameCost {
+	unsigned long frames;
+	unsigned long long bytes;
+	unsigned long long pixels;
+	unsigned long maxBytes;
+	unsigned long buckets[SIM_BUCKETS];   /* 0, <64, <256, <1K, <4K, <16K, <64K, more */
+
+	/* The pacer's figures for the whole run; the game clears its own
+	   after every level */
+	unsigned long timed;                  /* frames the pacer timed */
+	unsigned long long workSum;
+	unsigned long workMax;
+	unsigned long late;
+	unsigned long skipped;
+} FrameCost;
+
+static FrameCost cost;
+
+static double hostSeconds(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* One frame of the game, costed */
+static void frame(void)
+{
+	unsigned int bytes = spiBus.bytes;
+	unsigned long pixels = simPanelPixels;
+	uint32_t timed = pacer.frames, late = pacer.late, skipped = pacer.skipped;
+
+	gameFrame();
+
+	// frameEnd() comes last in a frame, so the pacer holds this frame's
+	// figures unless they were cleared before it, at the end of a level,
+	// or after it, at the end of a replay
+	if (pacer.frames <= timed) {
+		timed = late = skipped = 0;
+	}
+	if (pacer.frames > timed) {
+		cost.timed++;
+		cost.workSum += pacer.lastWork;
+		if (pacer.lastWork > cost.workMax) {
+			cost.workMax = pacer.lastWork;
+		}
+		cost.late += pacer.late - late;
+		cost.skipped += pacer.skipped - skipped;
+	}
+
+	bytes = spiBus.bytes - bytes;
+	cost.frames++;
+	cost.bytes += bytes;
+	cost.pixels += simPanelPixels - pixels;
+	if (bytes > cost.maxBytes) {
+		cost.maxBytes = bytes;
+	}
+	int b = 0;
+	if (bytes) {
+		b = 1;
+		for (unsigned int limit = 64; b < SIM_BUCKETS - 1 && bytes >= limit; limit <<= 2) {
+			b++;
+		}
+	}
+	cost.buckets[b]++;
+}
+
+static void report(double host, unsigned long games)
+{
+	static const char *names[SIM_BUCKETS] = { "0", "<64", "<256", "<1K", "<4K", "<16K", "<64K", ">=64K" };
+	unsigned long frames = cost.frames ? cost.frames : 1;
+
+	printf("%lu frames, %.1f s simulated, %.3f s host", cost.frames, simNow * 1e-9, host);
+	if (games) {
+		printf(", %.0f games/s", games / host);
+	}
+	printf("\n");
+	// the TFT is on a 10 MHz bus, 0.8 us a byte
+	printf("draw per frame: avg %llu bytes (%.0f us on the bus), %llu pixels, max %lu bytes\n",
+	       cost.bytes / frames, cost.bytes * 0.8 / frames, cost.pixels / frames, cost.maxBytes);
+	printf("bytes/frame:");
+	for (int i = 0; i < SIM_BUCKETS; i++) {
+		printf(" %s:%lu", names[i], cost.buckets[i]);
+	}
+	printf("\n");
+	printf("pacer: late %lu skipped %lu work avg %llu us max %lu us\n",
+	       cost.late, cost.skipped, cost.workSum / (cost.timed ? cost.timed : 1), cost.workMax);
+
+	uint32_t hash = 2166136261u;
+	for (int y = 0; y < simPanelHeight(); y++) {
+		for (int x = 0; x < simPanelWidth(); x++) {
+			hash = (hash ^ simPanelPixel(x, y)) * 16777619u;
+		}
+	}
+	printf("screen %08x\n", (unsigned)hash);
+}
+
+/* Tilt the board somewhere new every so often */
+static void scriptTilt(unsigned long n)
+{
+	if (n % SIM_TILT_FRAMES == 0) {
+		int x = rand() % (2 * SIM_TILT_MAX + 1) - SIM_TILT_MAX;
+		int y = rand() % (2 * SIM_TILT_MAX + 1) - SIM_TILT_MAX;
+		simAccelSet(x, y, 4096);
+	}
+}
+
+static int clampTilt(int v)
+{
+	return v < -SIM_STEER_MAX ? -SIM_STEER_MAX : (v > SIM_STEER_MAX ? SIM_STEER_MAX : v);
+}
+
+/* Tilt on one axis: a push if the hint goes that way, else back to the
+   middle of the cell, less a brake against the speed */
+static int steerAxis(int pos, int last, int step)
+{
+	int cell = 1 << FLOW_CELL_SHIFT;
+	int push = step * SIM_STEER_PUSH;
+	if (!step) {
+		push = ((pos & ~(cell - 1)) + cell / 2 - pos) * SIM_STEER_GAIN;
+	}
+	return clampTilt(push - (pos - last) * SIM_STEER_DAMP);
+}
+
+/* Tilt the way the hint points. The ball is the compositor's first
+   sprite. The board's x axis tilts the ball down the screen and its y
+   axis to the left. */
+static void steerTilt(int restart)
+{
+	static int lastX, lastY;
+	const CompSprite *b = &comp.sprites[0];
+	int dir = hintDirection();
+
+	if (restart) {
+		lastX = b->x;
+		lastY = b->y;
+	}
+	int ax = 0, ay = 0;
+	if (dir >= 0) {
+		ax = steerAxis(b->x, lastX, flowStepX[dir]);
+		ay = steerAxis(b->y, lastY, flowStepY[dir]);
+	}
+	simAccelSet(ay, -ax, 4096);
+	lastX = b->x;
+	lastY = b->y;
+}
+
+/* Rolls a marble of radius 6 from x,194 along the top of the walls
+   (y 200 on) toward toX, at each tilt from gentle to steep; it must get
+   past toX every time */
+static int checkRoll(const char *name, const PhysBox *walls, int numWalls, int x, int toX)
+{
+	int dir = toX > x ? 1 : -1;
+	int ok = 1;
+
+	for (int t = 1; t <= SIM_ROLL_TILTS; t++) {
+		Physics p;
+		Marble m;
+		physicsInit(&p, 320, 240);
+		physicsSetWalls(&p, walls, numWalls);
+		physicsSetTilt(&p, dir * t * SIM_ROLL_TILT, SIM_ROLL_PRESS, 4096);
+		marbleInit(&m, x, 194, 6);
+		for (int i = 0; i < SIM_ROLL_STEPS && (marbleX(&m) - toX) * dir <= 0; i++) {
+			physicsStep(&p, &m);
+		}
+		if ((marbleX(&m) - toX) * dir <= 0) {
+			printf("%s: stopped at %d,%d with tilt %d\n", name, marbleX(&m), marbleY(&m), t * SIM_ROLL_TILT);
+			ok = 0;
+		}
+	}
+	if (ok) {
+		printf("%s: ok\n", name);
+	}
+	return ok;
+}
+
+/* Rolls where the sweep used to stop the marble dead: on a seam between
+   two boxes that meet flush, and past the corner of a T */
+static int checkPhysics(void)
+{
+	static const PhysBox flush[2] = { {100, 200, 40, 7}, {141, 200, 40, 7} };
+	static const PhysBox tee[2] = { {124, 200, 39, 7}, {124, 200, 7, 39} };
+	int ok = 1;
+
+	ok &= checkRoll("flush boxes east", flush, 2, 110, 170);
+	ok &= checkRoll("flush boxes west", flush, 2, 170, 110);
+	ok &= checkRoll("T west", tee, 2, 150, 110);
+	return ok;
+}
+
+/* Press the panel at rawX,rawY for frames frames, moving stepX raw
+   counts a frame, then let go and leave time for a double tap to pass */
+static void touchStroke(int rawX, int rawY, int stepX, int frames)
+{
+	for (int i = 0; i < frames; i++) {
+		simTouchPress(rawX + i * stepX, rawY);
+		frame();
+	}
+	simTouchRelease();
+	for (int i = 0; i < SIM_GESTURE_GAP; i++) {
+		frame();
+	}
+}
+
+static void boardDoubleTap(void)
+{
+	simAccelEvents(MMA8451Q::EVENT_DOUBLE_TAP);
+	for (int i = 0; i < SIM_GESTURE_GAP; i++) {
+		frame();
+	}
+}
+
+static int expect(const char *what, int wantPaused, int wantHint)
+{
+	int ok = paused == wantPaused && hintOn == wantHint;
+	printf("%s: %s (paused %d, hint %d)\n", what, ok ? "ok" : "wrong", paused, hintOn);
+	return ok;
+}
+
+/* Plays the gestures on a level lying flat: a tap on the panel or a
+   double tap on the board pauses and resumes, a swipe shows the hint
+   and a long press dumps the recording, leaving both alone */
+static int checkGestures(void)
+{
+	int ok = 1;
+
+	touchStroke(2048, 2048, 0, 2);
+	ok &= expect("tap", 1, 0);
+	touchStroke(2048, 2048, 0, 2);
+	ok &= expect("tap again", 0, 0);
+	boardDoubleTap();
+	ok &= expect("double tap", 1, 0);
+	boardDoubleTap();
+	ok &= expect("double tap again", 0, 0);
+	touchStroke(1000, 2048, SIM_SWIPE_STEP, 4);
+	ok &= expect("swipe", 0, 1);
+	touchStroke(2048, 2048, 0, SIM_LONG_PRESS);
+	ok &= expect("long press", 0, 1);
+	return ok;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: labsim [-n games] [-s seed] [-e] [-h | -a] [-p screen.ppm]\n"
+	                "       labsim -r [-p screen.ppm] < dump.txt\n"
+	                "       labsim -c\n"
+	                "       labsim -g\n");
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	int games = 1000, seed = 1, endings = 0, replaying = 0, hints = 0, steer = 0, gestures = 0;
+	const char *ppm = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			games = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+			seed = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+			ppm = argv[++i];
+		} else if (!strcmp(argv[i], "-e")) {
+			endings = 1;
+		} else if (!strcmp(argv[i], "-h")) {
+			hints = 1;
+		} else if (!strcmp(argv[i], "-a")) {
+			hints = 1;
+			steer = 1;
+		} else if (!strcmp(argv[i], "-r")) {
+			replaying = 1;
+		} else if (!strcmp(argv[i], "-c")) {
+			return checkPhysics() ? 0 : 1;
+		} else if (!strcmp(argv[i], "-g")) {
+			gestures = 1;
+		} else {
+			usage();
+		}
+	}
+	srand(seed);
+	simPanelAttach(PTD0, PTC4);   // PIN_CS_TFT, PIN_DC_TFT
+
+	if (replaying) {
+		// gameSetup() reads the dump from stdin, as it would from the serial port
+		inputMode = INPUT_REPLAY;
+		gameSetup();
+		double start = hostSeconds();
+		while (inputMode == INPUT_REPLAY) {
+			frame();
+		}
+		report(hostSeconds() - start, 0);
+	} else {
+		// recording, so that the long press has something to dump
+		inputMode = gestures ? INPUT_RECORD : INPUT_LIVE;
+		gameSetup();
+		// the board lies level while the title screen calibrates the tilt
+		simAccelSet(0, 0, 4096);
+		while (titleCalibrating) {
+			gameFrame();
+		}
+		hintOn = hints;
+		if (gestures) {
+			sceneStart(&scenes, &gameScene);
+			return checkGestures() ? 0 : 1;
+		}
+		unsigned long won = 0, lost = 0, timeouts = 0, paintBytes = 0;
+		double start = hostSeconds();
+		for (int g = 0; g < games; g++) {
+			timelineClear(&timeline);
+			unsigned int bytes = spiBus.bytes;
+			sceneStart(&scenes, &gameScene);
+			paintBytes += spiBus.bytes - bytes;
+			unsigned long n = 0;
+			while (!(wonGame || lostGame) && n < SIM_MAX_FRAMES) {
+				if (steer) {
+					steerTilt(n++ == 0);
+				} else {
+					scriptTilt(n++);
+				}
+				frame();
+			}
+			while (endings && (wonGame || lostGame) && scenes.current == &gameScene && !sceneChanging(&scenes)) {
+				frame();
+			}
+			if (wonGame) {
+				won++;
+			} else if (lostGame) {
+				lost++;
+			} else {
+				timeouts++;
+			}
+		}
+		double host = hostSeconds() - start;
+		printf("%d games: won %lu lost %lu timed out %lu\n", games, won, lost, timeouts);
+		printf("level paint: avg %lu bytes\n", games ? paintBytes / games : 0);
+		report(host, games);
+	}
+	if (ppm != NULL && !simPanelDump(ppm)) {
+		fprintf(stderr, "can't write %s\n", ppm);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,186 @@
+/* Labyrinth simulator - the parts of mbed the game and its display
+ * driver use, on the host
+ *
+ * Time is virtual: it only moves when the SPI bus clocks data out (at
+ * the rate the bus is set to), when the program waits or when it sleeps
+ * in __WFI() until the next Ticker is due. Tickers fire as soon as the
+ * clock passes them, like the interrupt would. A run is therefore
+ * exactly repeatable and as fast as the host can go.
+ *
+ * Pins are a table of levels. SPI writes go to the ILI9341 panel model
+ * in Sim.h while its chip select is low.
+ */
+#ifndef MBED_H
+#define MBED_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <math.h>
+
+#define __align(x)
+
+/* Pins: port * 32 + pin */
+typedef enum {
+	PTA0 = 0, PTA1, PTA2, PTA3, PTA4, PTA5, PTA6, PTA7, PTA8, PTA9, PTA10, PTA11, PTA12, PTA13, PTA14, PTA15,
+	PTA16, PTA17, PTA18, PTA19, PTA20, PTA21, PTA22, PTA23, PTA24, PTA25, PTA26, PTA27, PTA28, PTA29, PTA30, PTA31,
+	PTB0, PTB1, PTB2, PTB3, PTB4, PTB5, PTB6, PTB7, PTB8, PTB9, PTB10, PTB11, PTB12, PTB13, PTB14, PTB15,
+	PTB16, PTB17, PTB18, PTB19, PTB20, PTB21, PTB22, PTB23, PTB24, PTB25, PTB26, PTB27, PTB28, PTB29, PTB30, PTB31,
+	PTC0, PTC1, PTC2, PTC3, PTC4, PTC5, PTC6, PTC7, PTC8, PTC9, PTC10, PTC11, PTC12, PTC13, PTC14, PTC15,
+	PTC16, PTC17, PTC18, PTC19, PTC20, PTC21, PTC22, PTC23, PTC24, PTC25, PTC26, PTC27, PTC28, PTC29, PTC30, PTC31,
+	PTD0, PTD1, PTD2, PTD3, PTD4, PTD5, PTD6, PTD7, PTD8, PTD9, PTD10, PTD11, PTD12, PTD13, PTD14, PTD15,
+	PTD16, PTD17, PTD18, PTD19, PTD20, PTD21, PTD22, PTD23, PTD24, PTD25, PTD26, PTD27, PTD28, PTD29, PTD30, PTD31,
+	PTE0, PTE1, PTE2, PTE3, PTE4, PTE5, PTE6, PTE7, PTE8, PTE9, PTE10, PTE11, PTE12, PTE13, PTE14, PTE15,
+	PTE16, PTE17, PTE18, PTE19, PTE20, PTE21, PTE22, PTE23, PTE24, PTE25, PTE26, PTE27, PTE28, PTE29, PTE30, PTE31,
+	SIM_PINS,
+	USBTX = SIM_PINS, USBRX,
+	NC = -1
+} PinName;
+
+extern uint8_t simPins[SIM_PINS];
+
+/* Panel fast path: while the display streams a row of pixels that lies
+   straight in its frame memory, SPI writes store them directly. Any pin
+   change ends the row (see Sim.cpp). */
+extern uint16_t *simRun;
+extern int simRunStride;
+extern int simRunLeft;
+extern int simRunLen;
+void simRunEnd(void);
+
+/* Virtual clock, ns */
+extern uint64_t simNow;
+extern uint64_t simNextTick;
+void simFireTickers(void);
+
+static inline void simAdvance(uint64_t ns)
+{
+	simNow += ns;
+	if (simNow >= simNextTick) {
+		simFireTickers();
+	}
+}
+
+static inline uint32_t us_ticker_read(void)
+{
+	return (uint32_t)(simNow / 1000);
+}
+
+static inline void wait_us(int us) { simAdvance((uint64_t)us * 1000); }
+static inline void wait_ms(int ms) { simAdvance((uint64_t)ms * 1000000); }
+static inline void wait(float s) { simAdvance((uint64_t)(s * 1e9f)); }
+
+/* Sleep until the next interrupt, i.e. the next Ticker */
+void simSleep(void);
+#define __WFI()          simSleep()
+#define __disable_irq()
+#define __enable_irq()
+
+void error(const char *format, ...);
+
+/* System register file, kept across resets on the K64F */
+typedef struct {
+	volatile uint32_t REG[8];
+} RFSYS_Type;
+extern RFSYS_Type simRfsys;
+#define RFSYS (&simRfsys)
+
+class DigitalOut
+{
+public:
+	DigitalOut(PinName pin, int value = 0) : m_pin(pin) { write(value); }
+	void write(int value) {
+		if (simRunLen) {
+			simRunEnd();
+		}
+		if (m_pin != NC) {
+			simPins[m_pin] = value ? 1 : 0;
+		}
+	}
+	int read(void) { return m_pin != NC ? simPins[m_pin] : 0; }
+	DigitalOut &operator= (int value) { write(value); return *this; }
+	operator int() { return read(); }
+private:
+	PinName m_pin;
+};
+
+class DigitalIn
+{
+public:
+	DigitalIn(PinName pin) : m_pin(pin) { }
+	int read(void) { return m_pin != NC ? simPins[m_pin] : 0; }
+	operator int() { return read(); }
+private:
+	PinName m_pin;
+};
+
+/* Panel model hook, see Sim.h */
+void simSpiWrite(int value, int bits);
+
+class SPI
+{
+public:
+	SPI(PinName mosi, PinName miso, PinName sclk) : m_bits(8), m_hz(1000000) { rate(); }
+	void format(int bits, int mode = 0) { m_bits = bits; rate(); }
+	void frequency(int hz = 1000000) { m_hz = hz; rate(); }
+	int write(int value) {
+		if (m_bits == 16 && simRunLeft) {
+			*simRun = value;
+			simRun += simRunStride;
+			simRunLeft--;
+		} else {
+			simSpiWrite(value, m_bits);
+		}
+		simAdvance(m_ns);
+		return 0;
+	}
+private:
+	void rate(void) { m_ns = (uint64_t)m_bits * 1000000000u / m_hz; }
+	int m_bits;
+	int m_hz;
+	uint64_t m_ns;
+};
+
+class Ticker
+{
+public:
+	Ticker() : m_slot(-1) { }
+	void attach_us(void (*fn)(void), uint32_t us);
+	void attach(void (*fn)(void), float s) { attach_us(fn, (uint32_t)(s * 1e6f)); }
+	void detach(void);
+private:
+	int m_slot;
+};
+
+class Stream
+{
+public:
+	Stream(const char *name = NULL) { }
+	virtual ~Stream() { }
+	int putc(int c) { return _putc(c); }
+	int getc(void) { return _getc(); }
+	int printf(const char *format, ...) {
+		char buf[256];
+		va_list args;
+		va_start(args, format);
+		int n = vsnprintf(buf, sizeof(buf), format, args);
+		va_end(args);
+		for (char *p = buf; *p; p++) {
+			_putc(*p);
+		}
+		return n;
+	}
+protected:
+	virtual int _putc(int c) = 0;
+	virtual int _getc() = 0;
+};
+
+class LocalFileSystem
+{
+public:
+	LocalFileSystem(const char *name) { }
+};
+
+#endif
@@ -29,6 +29,7 @@
 #include "MMA8451Q.h"
 #include <math.h>
 #include "SPI_TFT_ILI9341.h"
+#include "SPIBus.h"
 //#include "SPI_STMPE610.h"
 #include "Arial12x12.h"
 #include "Arial24x23.h"
@@ -37,6 +38,8 @@
 #include "mbed.h"
 //#include "ssd1289.h"
 #include "MyTouch.h"
+#include "EventQueue.h"
+#include "TouchCal.h"
 
 #if 1
 // For FRDM-K64F
@@ -67,29 +70,94 @@ volatile unsigned int xT, yT ;
 
 // SeeedStudioTFTv2 TFT(PIN_XP, PIN_XM, PIN_YP, PIN_YM, PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_DC_TFT, PIN_BL_TFT, PIN_CS_SD);
 //  SPI_TFT_ILI9341(PinName mosi, PinName miso, PinName sclk, PinName cs, PinName reset, PinName dc, const char* name ="TFT");
-SPI_TFT_ILI9341 TFT(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
+// the display and the touch controller share one SPI bus
+SPIBus spiBus(PIN_MOSI, PIN_MISO, PIN_SCLK) ;
+SPI_TFT_ILI9341 TFT(spiBus, PIN_CS_TFT, PIN_BL_TFT, PIN_DC_TFT) ;
 //SPI_STMPE610 TSC(PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TSC) ;
-// mosi, miso, sck, cs, irq pin, mode, pointer to touch panel irq handler
-MYTOUCH MyTouch( PIN_MOSI, PIN_MISO, PIN_SCLK, PIN_CS_TSC, PIN_TSC_INTR, USE_12BITS, &mytouch_irq_handler);
+// bus, cs, irq pin, mode, pointer to touch panel irq handler
+MYTOUCH MyTouch(spiBus, PIN_CS_TSC, PIN_TSC_INTR, USE_12BITS, &mytouch_irq_handler);
 
 DigitalIn pinD7(PIN_TSC_INTR) ;
 DigitalOut backlight(PIN_BACKLIGHT) ;
 
-/* Interrupt handler for touch screen */
+/* Interrupt handler for touch screen: only queue the touch, the
+   indicator is drawn from the main loop */
+EventQueue events;
+void mytouch_irq_handler(void)
+{
+		eventPost(&events, EVENT_TOUCH, 0, us_ticker_read());
+}
+
+/* Touch calibration: raw panel readings -> screen pixels */
+TouchCal touchCal;
+
+void drawCross(int x, int y, int color)
+{
+	TFT.line(x-8, y, x+8, y, color);
+	TFT.line(x, y-8, x, y+8, color);
+}
+
+/* Three-point calibration: touch each cross in turn. Runs once at
+   start-up, before the game loop, so polling the panel is fine here. */
+void calibrateTouch(void)
+{
+	int scrX[3], scrY[3], rawX[3], rawY[3];
+	int i, rx, ry;
+
+	touchCalSetOrientation(&touchCal, TFT.get_orientation());
+	scrX[0] = 20;                 scrY[0] = 20;
+	scrX[1] = TFT.width() - 20;   scrY[1] = TFT.height() / 2;
+	scrX[2] = TFT.width() / 2;    scrY[2] = TFT.height() - 20;
+
+	do {
+		TFT.cls();
+		TFT.locate(TFT.width()/2-60, TFT.height()/2-20);
+		TFT.printf("touch the crosses");
+		for (i = 0; i < 3; i++) {
+			drawCross(scrX[i], scrY[i], White);
+			while (!MyTouch.TP_GetRawPoint(&rx, &ry, TP_MAX_SAMPLES)) {
+				wait_ms(10);
+			}
+			// the first contact is noisy; take the reading once it settles
+			wait_ms(50);
+			MyTouch.TP_GetRawPoint(&rawX[i], &rawY[i], TP_MAX_SAMPLES);
+			drawCross(scrX[i], scrY[i], Green);
+			while (MyTouch.TP_GetRawPoint(&rx, &ry, 1)) {
+				wait_ms(10);
+			}
+		}
+	} while (!touchCalSolve(&touchCal, rawX, rawY, scrX, scrY));
+	TFT.cls();
+	// the crosses queued touch events of their own
+	Event ev;
+	while (eventGet(&events, &ev, us_ticker_read())) {
+	}
+}
+
 int paused = 0;
 int printed = 0;
-void mytouch_irq_handler(void)
+uint32_t lastTouch = 0;
+void dispatchEvents(void)
 {
-//		paused = 1-paused;
+	Event ev;
+	int rx, ry, x, y;
+	while (eventGet(&events, &ev, us_ticker_read())) {
+		// touches closer together than 100ms are contact bounce
+		if (ev.type != EVENT_TOUCH || ev.time - lastTouch < 100000) {
+			continue;
+		}
+		lastTouch = ev.time;
+		// mark where the panel was pressed
+		if (MyTouch.TP_GetRawPoint(&rx, &ry, 5) && touchCalMap(&touchCal, rx, ry, &x, &y)) {
+			TFT.fillcircle(x, y, 2, Yellow);
+		}
 		paused = 1-paused;
 		if (paused) {
 			TFT.fillcircle(300,60,10,Red) ;
-			wait(0.5);
 		} else {
 			TFT.fillcircle(300,60,10,Green) ;
 		}
-		
-		wait(0.1);
+	}
 }
 
 /* Screen initialization */
@@ -187,6 +255,7 @@ void Game(void) {
 		Ball ball = createBall(50, 50, 15, White);
 		
 		for(;;) {
+			dispatchEvents();
 			if (paused) {
 				if (!printed) {
 					TFT.locate(TFT.width()/2-10, TFT.height()/2);
@@ -220,6 +289,10 @@ int main()
 	// Initialize accelerometer inputting thing
 	acc = new MMA8451Q(PTE25, PTE24, MMA8451_I2C_ADDRESS) ;
 	
+	// Map the touch panel onto the screen in its current orientation
+	touchCalInit(&touchCal, 240, 320, 4095);
+	calibrateTouch();
+	
 	// Start game
 	Game();
     